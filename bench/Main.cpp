@@ -0,0 +1,60 @@
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+/**
+Benchmark runner for the Benchmarks build.
+
+	--json          write JSON instead of CSV
+	--accuracy      write the accuracy-versus-speed report instead of the
+	                benchmark suites (filter on "accuracy/func/backend")
+	--filter TEXT   only run cases whose "suite/name/form" contains TEXT
+	--min-time MS   minimum time per repetition in milliseconds (default 20)
+
+Results go to stdout so a run can be redirected and diffed against a
+previous release.
+*/
+
+int main(const int argc, const char* argv[])
+{
+	bool json = false;
+	bool accuracy = false;
+	std::string filter;
+	double minMilliseconds = 20.0;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--json") == 0)
+			json = true;
+		else if (std::strcmp(argv[i], "--csv") == 0)
+			json = false;
+		else if (std::strcmp(argv[i], "--accuracy") == 0)
+			accuracy = true;
+		else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+			filter = argv[++i];
+		else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+			minMilliseconds = std::atof(argv[++i]);
+		else {
+			std::cerr << "usage: " << argv[0] << " [--csv | --json] [--accuracy] [--filter TEXT] [--min-time MS]\n";
+			return 1;
+		}
+	}
+
+	bench::Runner runner(minMilliseconds / 1000.0, filter);
+
+	if (accuracy) {
+		bench::accuracyReport(runner, json, std::cout);
+		return 0;
+	}
+
+	bench::easingBenchmarks(runner);
+	bench::tweenBenchmarks(runner);
+
+	if (json)
+		runner.writeJson(std::cout);
+	else
+		runner.writeCsv(std::cout);
+
+	return 0;
+}
@@ -0,0 +1,409 @@
+#include "benchmark.hpp"
+#include "engine/easing.hpp"
+#include "engine/easing_table.hpp"
+#include "engine/fixed_easing.hpp"
+#include "engine/interpolate.hpp"
+#include "engine/piecewise_polynomial.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace animation;
+
+namespace bench {
+
+namespace {
+
+	typedef long double real;
+	typedef std::function<void(const float* t, float* out, std::size_t count)> Kernel;
+
+	// The sweep covers [0, 1] in steps of 2^-20, every point an exact float
+	const std::size_t SWEEP_STEPS = std::size_t(1) << 20;
+	const std::size_t BLOCK_SIZE = 4096;
+
+	const real PI_L = 3.141592653589793238462643383279502884L;
+
+	// ------------------------------------------------------------------
+	// Reference curves, written out independently of engine/easing.hpp
+	// from the formulas on easings.net. The expo and elastic curves snap to
+	// 0 and 1 at the ends like the normalized functors do.
+	// ------------------------------------------------------------------
+
+	real bounceOut(real t) {
+		const real n1 = 7.5625L;
+		const real d1 = 2.75L;
+
+		if (t < 1 / d1)
+			return n1 * t * t;
+		if (t < 2 / d1) {
+			t -= 1.5L / d1;
+			return n1 * t * t + 0.75L;
+		}
+		if (t < 2.5L / d1) {
+			t -= 2.25L / d1;
+			return n1 * t * t + 0.9375L;
+		}
+		t -= 2.625L / d1;
+		return n1 * t * t + 0.984375L;
+	}
+
+	real reference(InterpFunc func, real t) {
+		const real c1 = 1.70158L;
+		const real c2 = c1 * 1.525L;
+		const real c4 = 2 * PI_L / 3;
+		const real c5 = 2 * PI_L / 4.5L;
+
+		switch (func) {
+		case InterpFunc::Linear:         return t;
+		case InterpFunc::QuadEaseIn:     return t * t;
+		case InterpFunc::QuadEaseOut:    return 1 - (1 - t) * (1 - t);
+		case InterpFunc::QuadEaseInOut:  return t < 0.5L ? 2 * t * t : 1 - std::pow(-2 * t + 2, 2) / 2;
+		case InterpFunc::CubicEaseIn:    return t * t * t;
+		case InterpFunc::CubicEaseOut:   return 1 - std::pow(1 - t, 3);
+		case InterpFunc::CubicEaseInOut: return t < 0.5L ? 4 * t * t * t : 1 - std::pow(-2 * t + 2, 3) / 2;
+		case InterpFunc::QuartEaseIn:    return std::pow(t, 4);
+		case InterpFunc::QuartEaseOut:   return 1 - std::pow(1 - t, 4);
+		case InterpFunc::QuartEaseInOut: return t < 0.5L ? 8 * std::pow(t, 4) : 1 - std::pow(-2 * t + 2, 4) / 2;
+		case InterpFunc::QuintEaseIn:    return std::pow(t, 5);
+		case InterpFunc::QuintEaseOut:   return 1 - std::pow(1 - t, 5);
+		case InterpFunc::QuintEaseInOut: return t < 0.5L ? 16 * std::pow(t, 5) : 1 - std::pow(-2 * t + 2, 5) / 2;
+		case InterpFunc::SineEaseIn:     return 1 - std::cos(t * PI_L / 2);
+		case InterpFunc::SineEaseOut:    return std::sin(t * PI_L / 2);
+		case InterpFunc::SineEaseInOut:  return -(std::cos(PI_L * t) - 1) / 2;
+		case InterpFunc::ExpoEaseIn:     return t == 0 ? 0 : std::pow(2.L, 10 * t - 10);
+		case InterpFunc::ExpoEaseOut:    return t == 1 ? 1 : 1 - std::pow(2.L, -10 * t);
+		case InterpFunc::ExpoEaseInOut:
+			return t == 0 ? 0 : t == 1 ? 1
+				: t < 0.5L ? std::pow(2.L, 20 * t - 10) / 2 : (2 - std::pow(2.L, -20 * t + 10)) / 2;
+		case InterpFunc::CircEaseIn:     return 1 - std::sqrt(1 - t * t);
+		case InterpFunc::CircEaseOut:    return std::sqrt(1 - (t - 1) * (t - 1));
+		case InterpFunc::CircEaseInOut:
+			return t < 0.5L
+				? (1 - std::sqrt(1 - 4 * t * t)) / 2
+				: (std::sqrt(1 - std::pow(-2 * t + 2, 2)) + 1) / 2;
+		case InterpFunc::BackEaseIn:     return (c1 + 1) * t * t * t - c1 * t * t;
+		case InterpFunc::BackEaseOut:    return 1 + (c1 + 1) * std::pow(t - 1, 3) + c1 * std::pow(t - 1, 2);
+		case InterpFunc::BackEaseInOut:
+			return t < 0.5L
+				? (std::pow(2 * t, 2) * ((c2 + 1) * 2 * t - c2)) / 2
+				: (std::pow(2 * t - 2, 2) * ((c2 + 1) * (2 * t - 2) + c2) + 2) / 2;
+		case InterpFunc::ElasticEaseIn:
+			return t == 0 ? 0 : t == 1 ? 1
+				: -std::pow(2.L, 10 * t - 10) * std::sin((t * 10 - 10.75L) * c4);
+		case InterpFunc::ElasticEaseOut:
+			return t == 0 ? 0 : t == 1 ? 1
+				: std::pow(2.L, -10 * t) * std::sin((t * 10 - 0.75L) * c4) + 1;
+		case InterpFunc::ElasticEaseInOut:
+			return t == 0 ? 0 : t == 1 ? 1
+				: t < 0.5L
+					? -(std::pow(2.L, 20 * t - 10) * std::sin((20 * t - 11.125L) * c5)) / 2
+					: (std::pow(2.L, -20 * t + 10) * std::sin((20 * t - 11.125L) * c5)) / 2 + 1;
+		case InterpFunc::BounceEaseIn:   return 1 - bounceOut(1 - t);
+		case InterpFunc::BounceEaseOut:  return bounceOut(t);
+		case InterpFunc::BounceEaseInOut:
+			return t < 0.5L ? (1 - bounceOut(1 - 2 * t)) / 2 : (1 + bounceOut(2 * t - 1)) / 2;
+		default:                         return 1 - std::pow(1 - t, 4);
+		}
+	}
+
+	// ------------------------------------------------------------------
+	// Backends. Each returns an empty kernel when it has no form of func.
+	// ------------------------------------------------------------------
+
+	// The public scalar entry points of Interpolate, one call per element
+	float named(InterpFunc func, float t) {
+		switch (func) {
+		case InterpFunc::Linear:           return Interpolate::linear(t, 0.f, 1.f, 1.f);
+		case InterpFunc::QuadEaseIn:       return Interpolate::easeInQuad(t);
+		case InterpFunc::QuadEaseOut:      return Interpolate::easeOutQuad(t);
+		case InterpFunc::QuadEaseInOut:    return Interpolate::easeInOutQuad(t);
+		case InterpFunc::CubicEaseIn:      return Interpolate::easeInCubic(t);
+		case InterpFunc::CubicEaseOut:     return Interpolate::easeOutCubic(t);
+		case InterpFunc::CubicEaseInOut:   return Interpolate::easeInOutCubic(t);
+		case InterpFunc::QuartEaseIn:      return Interpolate::easeInQuart(t);
+		case InterpFunc::QuartEaseOut:     return Interpolate::easeOutQuart(t);
+		case InterpFunc::QuartEaseInOut:   return Interpolate::easeInOutQuart(t);
+		case InterpFunc::QuintEaseIn:      return Interpolate::easeInQuint(t);
+		case InterpFunc::QuintEaseOut:     return Interpolate::easeOutQuint(t);
+		case InterpFunc::QuintEaseInOut:   return Interpolate::easeInOutQuint(t);
+		case InterpFunc::SineEaseIn:       return Interpolate::easeInSine(t);
+		case InterpFunc::SineEaseOut:      return Interpolate::easeOutSine(t);
+		case InterpFunc::SineEaseInOut:    return Interpolate::easeInOutSine(t);
+		case InterpFunc::ExpoEaseIn:       return Interpolate::easeInExpo(t);
+		case InterpFunc::ExpoEaseOut:      return Interpolate::easeOutExpo(t);
+		case InterpFunc::ExpoEaseInOut:    return Interpolate::easeInOutExpo(t);
+		case InterpFunc::CircEaseIn:       return Interpolate::easeInCirc(t);
+		case InterpFunc::CircEaseOut:      return Interpolate::easeOutCirc(t);
+		case InterpFunc::CircEaseInOut:    return Interpolate::easeInOutCirc(t);
+		case InterpFunc::BackEaseIn:       return Interpolate::easeInBack(t, easing::BACK_C1);
+		case InterpFunc::BackEaseOut:      return Interpolate::easeOutBack(t, easing::BACK_C1);
+		case InterpFunc::BackEaseInOut:    return Interpolate::easeInOutBack(t, easing::BACK_C1);
+		case InterpFunc::ElasticEaseIn:    return Interpolate::easeInElastic(t);
+		case InterpFunc::ElasticEaseOut:   return Interpolate::easeOutElastic(t);
+		case InterpFunc::ElasticEaseInOut: return Interpolate::easeInOutElastic(t);
+		case InterpFunc::BounceEaseIn:     return Interpolate::easeInBounce(t);
+		case InterpFunc::BounceEaseOut:    return Interpolate::easeOutBounce(t);
+		case InterpFunc::BounceEaseInOut:  return Interpolate::easeInOutBounce(t, 0.f, 1.f, 1.f);
+		default:                           return Interpolate::easeOutQuart(t);
+		}
+	}
+
+	Kernel namedKernel(InterpFunc func) {
+		return [func](const float* t, float* out, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i)
+				out[i] = named(func, t[i]);
+		};
+	}
+
+	// The misspelt aliases still have their own definitions; check they agree
+	Kernel aliasKernel(InterpFunc func) {
+		float (*alias)(float) = func == InterpFunc::QuartEaseInOut ? &Interpolate::easeInOutQuard
+			: func == InterpFunc::QuintEaseOut ? &Interpolate::easeOutQuant
+			: nullptr;
+
+		if (!alias)
+			return Kernel();
+
+		return [alias](const float* t, float* out, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i)
+				out[i] = alias(t[i]);
+		};
+	}
+
+	// Inlined functors with the curve resolved once per block
+	template<class M>
+	Kernel functorKernel(InterpFunc func) {
+		return [func](const float* t, float* out, std::size_t count) {
+			easing::dispatch<M>(func, [&](auto curve) {
+				for (std::size_t i = 0; i < count; ++i)
+					out[i] = decltype(curve)::apply(t[i]);
+			});
+		};
+	}
+
+	Kernel tbcdKernel(InterpFunc func) {
+		return [func](const float* t, float* out, std::size_t count) {
+			easing::dispatch(func, [&](auto curve) {
+				for (std::size_t i = 0; i < count; ++i)
+					out[i] = decltype(curve)::apply(t[i], 0.f, 1.f, 1.f);
+			});
+		};
+	}
+
+	Kernel tableKernel(InterpFunc func) {
+		return [func](const float* t, float* out, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i)
+				out[i] = EasingTable::evaluate(func, t[i]);
+		};
+	}
+
+	Kernel batchKernel(InterpFunc func) {
+		return [func](const float* t, float* out, std::size_t count) {
+			Interpolate::evaluate(func, t, out, count);
+		};
+	}
+
+	Kernel batchTbcdKernel(InterpFunc func) {
+		auto zeros = std::make_shared<std::vector<float>>(BLOCK_SIZE, 0.f);
+		auto ones = std::make_shared<std::vector<float>>(BLOCK_SIZE, 1.f);
+
+		return [func, zeros, ones](const float* t, float* out, std::size_t count) {
+			for (std::size_t i = 0; i < count; i += BLOCK_SIZE) {
+				std::size_t n = std::min(BLOCK_SIZE, count - i);
+				Interpolate::evaluate(func, t + i, zeros->data(), ones->data(), ones->data(), out + i, n);
+			}
+		};
+	}
+
+	// Includes the conversion to and from Q16.16 at the boundary
+	Kernel fixedKernel(InterpFunc func) {
+		return [func](const float* t, float* out, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i)
+				out[i] = fixedpoint::toFloat(fixedpoint::evaluate(func, fixedpoint::fromFloat(t[i])));
+		};
+	}
+
+	Kernel polynomialKernel(InterpFunc func) {
+		auto fit = std::make_shared<PiecewisePolynomial>(func);
+
+		return [fit](const float* t, float* out, std::size_t count) {
+			fit->evaluate(t, out, count);
+		};
+	}
+
+	struct Backend {
+		const char* name;
+		Kernel (*make)(InterpFunc func);
+	};
+
+	const Backend BACKENDS[] = {
+		{ "exact",       &functorKernel<fastmath::ExactMath> },
+		{ "fast",        &functorKernel<fastmath::FastMath> },
+		{ "fastest",     &functorKernel<fastmath::FastestMath> },
+		{ "tbcd",        &tbcdKernel },
+		{ "interpolate", &namedKernel },
+		{ "alias",       &aliasKernel },
+		{ "table",       &tableKernel },
+		{ "batch",       &batchKernel },
+		{ "batch_tbcd",  &batchTbcdKernel },
+		{ "fixed",       &fixedKernel },
+		{ "polynomial",  &polynomialKernel }
+	};
+
+	// References smaller than this are measured in ULPs at this magnitude, so
+	// curves passing through zero are not charged denormal-sized steps
+	const real ULP_FLOOR = 1.L / 1024;
+
+	// Error in units of the float spacing at the reference value
+	double ulpError(real error, real reference) {
+		real magnitude = std::max(std::fabs(reference), ULP_FLOOR);
+		real spacing = std::ldexp(1.L, std::ilogb(magnitude) - (std::numeric_limits<float>::digits - 1));
+		return static_cast<double>(error / spacing);
+	}
+
+	struct Accuracy {
+		std::string func;
+		std::string backend;
+		double maxAbsError;
+		double meanAbsError;
+		double maxUlpError;
+		double nsPerItem;
+	};
+
+	Accuracy measure(const Kernel& kernel, const std::vector<float>& times, const std::vector<real>& expected) {
+		std::vector<float> out(BLOCK_SIZE);
+		double maxAbs = 0.0;
+		double sumAbs = 0.0;
+		double maxUlp = 0.0;
+
+		for (std::size_t block = 0; block < times.size(); block += BLOCK_SIZE) {
+			std::size_t n = std::min(BLOCK_SIZE, times.size() - block);
+			kernel(times.data() + block, out.data(), n);
+
+			for (std::size_t i = 0; i < n; ++i) {
+				if (!std::isfinite(out[i])) {
+					maxAbs = maxUlp = std::numeric_limits<double>::infinity();
+					continue;
+				}
+
+				real ref = expected[block + i];
+				real err = std::fabs(static_cast<real>(out[i]) - ref);
+
+				maxAbs = std::max(maxAbs, static_cast<double>(err));
+				maxUlp = std::max(maxUlp, ulpError(err, ref));
+				sumAbs += static_cast<double>(err);
+			}
+		}
+
+		return Accuracy { "", "", maxAbs, sumAbs / times.size(), maxUlp, 0.0 };
+	}
+}
+
+void accuracyReport(Runner& runner, bool json, std::ostream& out) {
+	EasingTable::build();
+
+	std::vector<float> sweep(SWEEP_STEPS + 1);
+	for (std::size_t i = 0; i <= SWEEP_STEPS; ++i)
+		sweep[i] = static_cast<float>(i) / static_cast<float>(SWEEP_STEPS);
+
+	// Shuffled times for the throughput column, as in the easing suite
+	std::vector<float> shuffled(BLOCK_SIZE);
+	std::vector<float> scratch(BLOCK_SIZE);
+	std::uint32_t state = 12345u;
+	for (float& t : shuffled) {
+		state = state * 1664525u + 1013904223u;
+		t = (state >> 8) * (1.f / 16777216.f);
+	}
+
+	std::vector<Accuracy> rows;
+	std::vector<real> expected(sweep.size());
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+		const std::string name = funcName(func);
+		bool referenced = false;
+
+		for (const Backend& backend : BACKENDS) {
+			if (!runner.selected("accuracy", name, backend.name))
+				continue;
+
+			Kernel kernel = backend.make(func);
+			if (!kernel)
+				continue;
+
+			if (!referenced) {
+				for (std::size_t i = 0; i < sweep.size(); ++i)
+					expected[i] = reference(func, sweep[i]);
+				referenced = true;
+			}
+
+			Accuracy row = measure(kernel, sweep, expected);
+			row.func = name;
+			row.backend = backend.name;
+
+			runner.run("accuracy", name, backend.name, BLOCK_SIZE, [&] {
+				kernel(shuffled.data(), scratch.data(), BLOCK_SIZE);
+				consume(scratch[BLOCK_SIZE / 2]);
+			});
+			row.nsPerItem = runner.results().back().nsPerItem;
+
+			rows.push_back(row);
+		}
+	}
+
+	if (json) {
+		out << "{\n";
+		out << "  \"instruction_set\": \"" << Interpolate::batchInstructionSet() << "\",\n";
+		out << "  \"cpu_features\": \"" << CpuFeatures::describe() << "\",\n";
+		out << "  \"sweep_points\": " << sweep.size() << ",\n";
+		out << "  \"results\": [\n";
+	}
+	else {
+		out << "func,backend,max_abs_error,mean_abs_error,max_ulp_error,ns_per_item\n";
+	}
+
+	for (std::size_t i = 0; i < rows.size(); ++i) {
+		const Accuracy& r = rows[i];
+
+		if (json) {
+			out << "    { \"func\": \"" << r.func << "\", \"backend\": \"" << r.backend << "\", "
+				<< std::scientific << std::setprecision(3) << "\"max_abs_error\": ";
+
+			// JSON has no infinity; a backend that produced inf or NaN reports
+			// null for both maxima
+			if (std::isfinite(r.maxAbsError))
+				out << r.maxAbsError << ", ";
+			else
+				out << "null, ";
+
+			out << "\"mean_abs_error\": " << r.meanAbsError << ", "
+				<< std::fixed << std::setprecision(1) << "\"max_ulp_error\": ";
+
+			if (std::isfinite(r.maxUlpError))
+				out << r.maxUlpError << ", ";
+			else
+				out << "null, ";
+
+			out
+				<< std::setprecision(3) << "\"ns_per_item\": " << r.nsPerItem << " }"
+				<< (i + 1 < rows.size() ? ",\n" : "\n");
+		}
+		else {
+			out << r.func << ',' << r.backend << ','
+				<< std::scientific << std::setprecision(3) << r.maxAbsError << ',' << r.meanAbsError << ','
+				<< std::fixed << std::setprecision(1) << r.maxUlpError << ','
+				<< std::setprecision(3) << r.nsPerItem << '\n';
+		}
+	}
+
+	if (json)
+		out << "  ]\n}\n";
+}
+
+}
@@ -0,0 +1,93 @@
+#include "benchmark.hpp"
+#include "engine/easing.hpp"
+#include "engine/interpolate.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace animation;
+
+namespace bench {
+
+namespace {
+
+	// Enough elements to amortize the loop, small enough to stay in L1
+	const std::size_t SAMPLES = 4096;
+
+	struct Inputs {
+		std::vector<float> t, b, c, d, normalized;
+		std::vector<float> out;
+
+		Inputs() : t(SAMPLES), b(SAMPLES), c(SAMPLES), d(SAMPLES), normalized(SAMPLES), out(SAMPLES) {
+			// Shuffled times from a fixed seed so the piecewise curves see every
+			// phase in no particular order, as they do in a real scene
+			std::uint32_t state = 12345u;
+			for (std::size_t i = 0; i < SAMPLES; ++i) {
+				state = state * 1664525u + 1013904223u;
+				float u = (state >> 8) * (1.f / 16777216.f);
+
+				d[i] = 0.5f + static_cast<float>(i % 7) * 0.25f;
+				t[i] = u * d[i];
+				b[i] = static_cast<float>(i % 13) * 10.f - 60.f;
+				c[i] = 200.f - static_cast<float>(i % 5) * 75.f;
+				normalized[i] = u;
+			}
+		}
+	};
+
+	void benchmarkCurve(Runner& runner, InterpFunc func, Inputs& in) {
+		const std::string name = funcName(func);
+
+		// Scalar forms: the curve is resolved once, as Tween::update() does,
+		// so the timing is the inlined functor body per element
+		easing::dispatch(func, [&](auto curve) {
+			typedef decltype(curve) Curve;
+
+			runner.run("easing", name, "normalized", SAMPLES, [&] {
+				float sum = 0.f;
+				for (std::size_t i = 0; i < SAMPLES; ++i)
+					sum += Curve::apply(in.normalized[i]);
+				consume(sum);
+			});
+
+			runner.run("easing", name, "tbcd", SAMPLES, [&] {
+				float sum = 0.f;
+				for (std::size_t i = 0; i < SAMPLES; ++i)
+					sum += Curve::apply(in.t[i], in.b[i], in.c[i], in.d[i]);
+				consume(sum);
+			});
+		});
+
+		// Runtime dispatch per call, for callers that only hold an InterpFunc
+		runner.run("easing", name, "normalized_dispatch", SAMPLES, [&] {
+			float sum = 0.f;
+			for (std::size_t i = 0; i < SAMPLES; ++i)
+				sum += easing::evaluate(func, in.normalized[i]);
+			consume(sum);
+		});
+
+		runner.run("easing", name, "normalized_batch", SAMPLES, [&] {
+			Interpolate::evaluate(func, in.normalized.data(), in.out.data(), SAMPLES);
+			consume(in.out[SAMPLES / 2]);
+		});
+
+		runner.run("easing", name, "tbcd_batch", SAMPLES, [&] {
+			Interpolate::evaluate(func, in.t.data(), in.b.data(), in.c.data(), in.d.data(), in.out.data(), SAMPLES);
+			consume(in.out[SAMPLES / 2]);
+		});
+
+		runner.run("easing", name, "velocity_batch", SAMPLES, [&] {
+			Interpolate::evaluateVelocity(func, in.normalized.data(), in.out.data(), SAMPLES);
+			consume(in.out[SAMPLES / 2]);
+		});
+	}
+}
+
+void easingBenchmarks(Runner& runner) {
+	Inputs inputs;
+
+	for (int i = 1; i <= INTERP_FUNC_COUNT; ++i)
+		benchmarkCurve(runner, static_cast<InterpFunc>(i), inputs);
+}
+
+}
@@ -0,0 +1,152 @@
+#include "benchmark.hpp"
+#include "engine/tween.hpp"
+#include "engine/tween_manager.hpp"
+#include "engine/job_system.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+namespace {
+
+	const float FRAME = 1.f / 60.f;
+
+	// Long enough that no tween finishes while it is being timed at the
+	// default --min-time; checkRunning() reports when one does
+	const float DURATION = 3600.f;
+
+	// DURATION only leaves so much headroom; a long --min-time on a fast
+	// machine lets tweens finish mid-measurement, which skews the timing
+	void checkRunning(const std::string& name, const std::string& form, bool running) {
+		if (!running)
+			std::cerr << "warning: tween/" << name << "/" << form
+					  << ": tweens finished while timed; lower --min-time\n";
+	}
+
+	void benchmarkUpdate(Runner& runner, std::size_t count) {
+		std::string name = std::to_string(count);
+		if (!runner.selected("tween", name, "update"))
+			return;
+
+		// Tween is not movable; a deque constructs in place without relocating
+		std::vector<float> properties(count);
+		std::deque<Tween> tweens;
+
+		std::uint32_t state = 6789u;
+		for (std::size_t i = 0; i < count; ++i) {
+			InterpFunc func = static_cast<InterpFunc>(1 + i % INTERP_FUNC_COUNT);
+			tweens.emplace_back(&properties[i], 0.f, 100.f, DURATION, func);
+
+			// Spread the tweens over the whole curve so every phase is hit
+			state = state * 1664525u + 1013904223u;
+			tweens.back().start();
+			tweens.back().update((state >> 8) * (1.f / 16777216.f) * DURATION * 0.9f);
+		}
+
+		runner.run("tween", name, "update", count, [&] {
+			for (Tween& tween : tweens)
+				tween.update(FRAME);
+			consume(properties[count / 2]);
+		});
+
+		bool running = true;
+		for (const Tween& tween : tweens)
+			running = running && tween.isAnimating();
+		checkRunning(name, "update", running);
+	}
+
+	// Every tween starts at a random point of its curve
+	void fillManager(TweenManager& manager, std::vector<float>& properties) {
+		const std::size_t count = properties.size();
+		manager.reserve(count / INTERP_FUNC_COUNT + 1);
+
+		std::uint32_t state = 6789u;
+		for (std::size_t i = 0; i < count; ++i) {
+			InterpFunc func = static_cast<InterpFunc>(1 + i % INTERP_FUNC_COUNT);
+
+			state = state * 1664525u + 1013904223u;
+			float phase = (state >> 8) * (1.f / 16777216.f) * 0.9f;
+			manager.add(&properties[i], 0.f, 100.f, DURATION, func, phase * DURATION);
+		}
+	}
+
+	void benchmarkManagerUpdate(Runner& runner, std::size_t count) {
+		std::string name = std::to_string(count);
+		if (!runner.selected("tween", name, "manager_update"))
+			return;
+
+		std::vector<float> properties(count);
+		TweenManager manager;
+		fillManager(manager, properties);
+
+		runner.run("tween", name, "manager_update", count, [&] {
+			manager.update(FRAME);
+			consume(properties[count / 2]);
+		});
+		checkRunning(name, "manager_update", manager.size() == count);
+	}
+
+	// The same update under the Fast policy, which runs on the batch kernels
+	void benchmarkManagerUpdateFast(Runner& runner, std::size_t count) {
+		std::string name = std::to_string(count);
+		if (!runner.selected("tween", name, "manager_update_fast"))
+			return;
+
+		std::vector<float> properties(count);
+		TweenManager manager;
+		fillManager(manager, properties);
+
+		const EasingPrecision precision = Tween::getDefaultPrecision();
+		Tween::setDefaultPrecision(EasingPrecision::Fast);
+
+		runner.run("tween", name, "manager_update_fast", count, [&] {
+			manager.update(FRAME);
+			consume(properties[count / 2]);
+		});
+
+		Tween::setDefaultPrecision(precision);
+		checkRunning(name, "manager_update_fast", manager.size() == count);
+	}
+
+	// Same update spread over a JobSystem, e.g. form "manager_threads_4"
+	void benchmarkManagerScaling(Runner& runner, std::size_t count, std::size_t threads) {
+		std::string name = std::to_string(count);
+		std::string form = "manager_threads_" + std::to_string(threads);
+		if (!runner.selected("tween", name, form))
+			return;
+
+		std::vector<float> properties(count);
+		TweenManager manager;
+		fillManager(manager, properties);
+		animation::JobSystem jobs(threads);
+
+		runner.run("tween", name, form, count, [&] {
+			manager.update(FRAME, jobs);
+			consume(properties[count / 2]);
+		});
+		checkRunning(name, form, manager.size() == count);
+	}
+}
+
+void tweenBenchmarks(Runner& runner) {
+	const std::size_t counts[] = { 1000, 100000, 1000000 };
+
+	for (std::size_t count : counts) {
+		benchmarkUpdate(runner, count);
+		benchmarkManagerUpdate(runner, count);
+		benchmarkManagerUpdateFast(runner, count);
+	}
+
+	// Thread scaling where there is enough work per frame to share out
+	const std::size_t threadCounts[] = { 1, 2, 4, 8 };
+	for (std::size_t threads : threadCounts) {
+		benchmarkManagerScaling(runner, 100000, threads);
+		benchmarkManagerScaling(runner, 1000000, threads);
+	}
+}
+
+}
@@ -0,0 +1,81 @@
+#include "benchmark.hpp"
+#include "engine/interpolate.hpp"
+
+#include <iomanip>
+
+namespace bench {
+
+const int Runner::REPETITIONS = 5;
+
+namespace {
+
+	volatile float g_sink = 0.f;
+
+	const char* const FUNC_NAMES[INTERP_FUNC_COUNT] = {
+		"Linear",
+		"QuadEaseIn", "QuadEaseOut", "QuadEaseInOut",
+		"CubicEaseIn", "CubicEaseOut", "CubicEaseInOut",
+		"QuartEaseIn", "QuartEaseOut", "QuartEaseInOut",
+		"QuintEaseIn", "QuintEaseOut", "QuintEaseInOut",
+		"SineEaseIn", "SineEaseOut", "SineEaseInOut",
+		"ExpoEaseIn", "ExpoEaseOut", "ExpoEaseInOut",
+		"CircEaseIn", "CircEaseOut", "CircEaseInOut",
+		"BackEaseIn", "BackEaseOut", "BackEaseInOut",
+		"ElasticEaseIn", "ElasticEaseOut", "ElasticEaseInOut",
+		"BounceEaseIn", "BounceEaseOut", "BounceEaseInOut" };
+}
+
+const char* funcName(InterpFunc func) {
+	int i = static_cast<int>(func);
+	return i >= 1 && i <= INTERP_FUNC_COUNT ? FUNC_NAMES[i - 1] : "Unknown";
+}
+
+void consume(float value) {
+	g_sink = g_sink + value;
+}
+
+Runner::Runner(double minSeconds, const std::string& filter)
+		: m_minSeconds(minSeconds)
+		, m_filter(filter) {
+}
+
+bool Runner::selected(const std::string& suite, const std::string& name, const std::string& form) const {
+	return m_filter.empty()
+		|| (suite + "/" + name + "/" + form).find(m_filter) != std::string::npos;
+}
+
+const std::vector<Result>& Runner::results() const {
+	return m_results;
+}
+
+void Runner::writeCsv(std::ostream& out) const {
+	out << "suite,name,form,items,ns_per_item,items_per_second\n";
+	out << std::fixed;
+
+	for (const Result& r : m_results) {
+		out << r.suite << ',' << r.name << ',' << r.form << ',' << r.items << ','
+			<< std::setprecision(3) << r.nsPerItem << ','
+			<< std::setprecision(0) << r.itemsPerSecond << '\n';
+	}
+}
+
+void Runner::writeJson(std::ostream& out) const {
+	out << "{\n";
+	out << "  \"instruction_set\": \"" << animation::Interpolate::batchInstructionSet() << "\",\n";
+	out << "  \"cpu_features\": \"" << animation::CpuFeatures::describe() << "\",\n";
+	out << "  \"results\": [\n";
+	out << std::fixed;
+
+	for (std::size_t i = 0; i < m_results.size(); ++i) {
+		const Result& r = m_results[i];
+		out << "    { \"suite\": \"" << r.suite << "\", \"name\": \"" << r.name
+			<< "\", \"form\": \"" << r.form << "\", \"items\": " << r.items
+			<< ", \"ns_per_item\": " << std::setprecision(3) << r.nsPerItem
+			<< ", \"items_per_second\": " << std::setprecision(0) << r.itemsPerSecond << " }"
+			<< (i + 1 < m_results.size() ? ",\n" : "\n");
+	}
+
+	out << "  ]\n}\n";
+}
+
+}
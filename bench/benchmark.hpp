@@ -0,0 +1,102 @@
+#ifndef Benchmark_Hpp
+#define Benchmark_Hpp
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "engine/interp_func.hpp"
+
+namespace bench {
+
+	// One timed case; times are the best of Runner::REPETITIONS runs
+	struct Result {
+		std::string suite;
+		std::string name;
+		std::string form;
+		std::size_t items;			// elements processed per call of the body
+		double nsPerItem;
+		double itemsPerSecond;
+	};
+
+	/**
+	Minimal timing harness for the Benchmarks build.
+
+	Each case calls its body repeatedly until at least the minimum time
+	has passed, and the fastest of several such runs is kept so that
+	scheduler noise only ever makes a case look slower. Results are
+	written as CSV or JSON so runs from two releases can be diffed.
+	*/
+
+	class Runner {
+	private:
+		double m_minSeconds;
+		std::string m_filter;
+		std::vector<Result> m_results;
+
+	public:
+		static const int REPETITIONS;
+
+		Runner(double minSeconds, const std::string& filter);
+
+		// False when the case is excluded by the filter ("suite/name/form" substring)
+		bool selected(const std::string& suite, const std::string& name, const std::string& form) const;
+
+		// Times body(), which processes items elements per call
+		template<class F>
+		void run(const std::string& suite, const std::string& name, const std::string& form,
+				 std::size_t items, F&& body) {
+			if (!selected(suite, name, form))
+				return;
+
+			typedef std::chrono::steady_clock Clock;
+			body();	// warm caches and lazily built tables
+
+			double best = 0.0;
+			for (int r = 0; r < REPETITIONS; ++r) {
+				std::size_t calls = 0;
+				double elapsed = 0.0;
+				Clock::time_point start = Clock::now();
+
+				do {
+					body();
+					++calls;
+					elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+				} while (elapsed < m_minSeconds);
+
+				double ns = elapsed * 1e9 / (static_cast<double>(calls) * items);
+				best = r == 0 || ns < best ? ns : best;
+			}
+
+			m_results.push_back(Result { suite, name, form, items, best, 1e9 / best });
+		}
+
+		const std::vector<Result>& results() const;
+
+		void writeCsv(std::ostream& out) const;
+		void writeJson(std::ostream& out) const;
+	};
+
+	// Identifier of an easing function as used in the output, e.g. "QuadEaseIn"
+	const char* funcName(InterpFunc func);
+
+	// Keeps a computed value alive so the optimizer cannot drop the work
+	void consume(float value);
+
+	// Suites, in bench/bench_*.cpp
+	void easingBenchmarks(Runner& runner);
+	void tweenBenchmarks(Runner& runner);
+
+	/** Accuracy-versus-speed report, in bench/accuracy.cpp.
+
+	Sweeps t over [0, 1] for every InterpFunc and every evaluation backend
+	(functors under each math policy, (t,b,c,d) form, Interpolate entry
+	points and aliases, table, batch, fixed point, piecewise polynomial),
+	compares each against a long double reference and writes the max and
+	mean absolute error, max ULP error and ns per evaluation.
+	*/
+	void accuracyReport(Runner& runner, bool json, std::ostream& out);
+}
+
+#endif
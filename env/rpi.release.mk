@@ -1,5 +1,5 @@
 CC := g++-8.1.0
-CFLAGS := $(CFLAGS) -fpic
+CFLAGS := $(CFLAGS) -fpic -mfpu=neon-vfpv4 -mfloat-abi=hard
 MAX_PARALLEL_JOBS := 4
 
 LIB_DIRS := \
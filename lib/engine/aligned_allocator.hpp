@@ -0,0 +1,47 @@
+#ifndef AlignedAllocator_Hpp
+#define AlignedAllocator_Hpp
+
+#include <cstddef>
+#include <new>
+
+namespace animation {
+
+	// Cache line size on the x86-64 and ARM targets we build for
+	constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+	/**
+	std::vector allocator that starts the storage on an Alignment-byte
+	boundary, so ranges whose first index is a multiple of
+	Alignment / sizeof(T) begin on their own cache line and threads working
+	on neighbouring ranges don't write to the same line.
+	*/
+	template<class T, std::size_t Alignment = CACHE_LINE_SIZE>
+	struct AlignedAllocator {
+		typedef T value_type;
+
+		// Needed because Alignment is not a type parameter
+		template<class U>
+		struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+		AlignedAllocator() = default;
+
+		template<class U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+		T* allocate(std::size_t count) {
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+		}
+
+		void deallocate(T* pointer, std::size_t) {
+			::operator delete(pointer, std::align_val_t(Alignment));
+		}
+
+		template<class U>
+		bool operator== (const AlignedAllocator<U, Alignment>&) const { return true; }
+
+		template<class U>
+		bool operator!= (const AlignedAllocator<U, Alignment>&) const { return false; }
+	};
+}
+
+#endif
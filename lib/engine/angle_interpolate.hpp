@@ -0,0 +1,56 @@
+#ifndef AngleInterpolate_Hpp
+#define AngleInterpolate_Hpp
+
+#include <cstddef>
+#include "engine/interp_func.hpp"
+
+namespace animation {
+
+	/**
+	Rotation easing along the shortest arc.
+
+	Angles are in degrees, as used by sf::Transformable and sf::View.
+	The turn from one angle to another is first reduced to [-180, 180),
+	so 350 -> 10 turns 20 degrees forwards instead of 340 back. Results
+	are wrapped into [0, 360). An exact half turn goes counter-clockwise
+	(decreasing angle).
+
+	In 2D this is the same as slerp between the two unit rotations, with
+	the weight eased by any InterpFunc.
+	*/
+
+	class AngleInterpolate {
+	public:
+		AngleInterpolate() = delete;
+		AngleInterpolate(const AngleInterpolate&) = delete;
+		AngleInterpolate& operator= (const AngleInterpolate&) = delete;
+
+		// Angle in [0, 360)
+		static float wrap(float degrees);
+
+		// Signed turn in [-180, 180) from one angle to another
+		static float shortestArc(float from, float to);
+
+		// from + shortestArc(from, to) * w, wrapped
+		static float lerp(float from, float to, float w);
+
+		// Same with the weight func(t)
+		static float interpolate(InterpFunc func, float from, float to, float t);
+
+		/** out[i] = interpolate(func, from[i], to[i], t[i]) for count
+		rotations. Weights come from the SIMD batch kernels and the arc
+		and wrap run vectorized with the same lane types.
+		*/
+		static void evaluate(InterpFunc func, const float* t, const float* from, const float* to,
+							 float* out, std::size_t count);
+	};
+
+	// Lerp trait for ValueTween<float, ShortestArcLerp>
+	struct ShortestArcLerp {
+		static float lerp(float from, float to, float w) {
+			return AngleInterpolate::lerp(from, to, w);
+		}
+	};
+}
+
+#endif
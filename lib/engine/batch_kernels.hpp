@@ -0,0 +1,54 @@
+#ifndef BatchKernels_Hpp
+#define BatchKernels_Hpp
+
+#include <cstddef>
+#include "engine/cpu_features.hpp"
+#include "engine/interp_func.hpp"
+
+namespace animation {
+namespace kernels {
+
+	/**
+	Batch easing entry points built for one instruction set.
+
+	src/engine/interpolate_batch.cpp builds the kernels with the project's
+	compiler flags; interpolate_batch_avx2.cpp, _avx512.cpp and _neon.cpp
+	build them again for wider targets. Interpolate picks the widest table
+	the CPU supports on first use (see Interpolate::useInstructionSet()).
+	TweenManager::update() evaluates its Fast and Fastest buckets through
+	the same table, so tween updates use the selected kernels too.
+	*/
+	struct BatchTable {
+		InstructionSet isa;
+		const char* name;
+
+		void (*evaluate)(InterpFunc func,
+						 const float* t, const float* b, const float* c, const float* d,
+						 float* out, std::size_t count);
+
+		void (*evaluateNormalized)(InterpFunc func, const float* t, float* out, std::size_t count);
+
+		// First and second derivatives, same layout as evaluate and evaluateNormalized
+		void (*velocity)(InterpFunc func,
+						 const float* t, const float* b, const float* c, const float* d,
+						 float* out, std::size_t count);
+
+		void (*velocityNormalized)(InterpFunc func, const float* t, float* out, std::size_t count);
+
+		void (*acceleration)(InterpFunc func,
+							 const float* t, const float* b, const float* c, const float* d,
+							 float* out, std::size_t count);
+
+		void (*accelerationNormalized)(InterpFunc func, const float* t, float* out, std::size_t count);
+	};
+
+	// Null when the target is not available to this compiler
+	const BatchTable* baselineBatchTable();
+	const BatchTable* avx2BatchTable();
+	const BatchTable* avx512BatchTable();
+	const BatchTable* neonBatchTable();
+	const BatchTable* scalarBatchTable();
+}
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef BranchlessSearch_Hpp
+#define BranchlessSearch_Hpp
+
+#include <cstddef>
+
+namespace animation {
+
+	/**
+	Index of the last of the count sorted values that is <= x, clamped to
+	[0, count - 2] so it always names a valid interval [i, i + 1]; count
+	must be at least 2.
+
+	Shared by the breakpoint lookups of KeyframeCurve, PiecewisePolynomial
+	and SplinePath. The range is halved a fixed number of times for a
+	given count and the select compiles to a conditional move, so the
+	search costs the same for every x and never mispredicts.
+	*/
+	inline std::size_t branchlessUpperIndex(const float* values, std::size_t count, float x) {
+		const float* base = values;
+		std::size_t n = count - 1;	// intervals
+
+		while (n > 1) {
+			std::size_t half = n / 2;
+			base = base[half] <= x ? base + half : base;
+			n -= half;
+		}
+
+		return static_cast<std::size_t>(base - values);
+	}
+}
+
+#endif
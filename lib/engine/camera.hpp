@@ -2,7 +2,8 @@
 #define Camera_Hpp
 
 #include <SFML/Graphics.hpp>
-#include "engine/tween.hpp"
+#include "engine/value_tween.hpp"
+#include "engine/tween_pool.hpp"
 #include "engine/circle.hpp"
 
 class Camera {
@@ -23,10 +24,12 @@ private:
 	*/
 	InterpFunc 		m_interpolation;
 	float      		m_duration;
-	Tween*			m_tweenX;
-	Tween*			m_tweenY;
-	bool 			m_tweenXActive;
-	bool 			m_tweenYActive;
+	const animation::Spring* m_spring;
+
+	// Running tween, in a pool owned by the demo (not owned); a stale
+	// handle means the camera is following the player
+	TweenPool<ValueTween<sf::Vector2f>>* m_tweens;
+	TweenHandle		m_tween;
 
 private:
 	void initDefault();
@@ -34,16 +37,16 @@ private:
 	void calculateMinMaxPos(
 		const sf::Vector2u& backgroundSize, const sf::Vector2f& resolution);
 
-	void spawnTweenX(float targetX);
-	void spawnTweenY(float targetY);
+	void spawnTween(const sf::Vector2f& target);
 
 public:
 	/** Initialises a camera with default values.
 	*
 	* Disables clamping to the background size and provides
-	* default interpolation and duration values for the tweens.
+	* default interpolation and duration values for the tweens,
+	* which are created in the tweens pool.
 	*/
-	Camera();
+	explicit Camera(TweenPool<ValueTween<sf::Vector2f>>& tweens);
 
 	/** Initialises a camera for clamping to a background.
 	*
@@ -51,12 +54,13 @@ public:
 	* position to the background container. Default interpolation
 	* and duration values are initialised.
 	*/
-	Camera(const sf::Vector2f& position,
+	Camera(TweenPool<ValueTween<sf::Vector2f>>& tweens,
+		   const sf::Vector2f& position,
 		   const sf::Vector2u& backgroundSize,
 		   const sf::Vector2f& resolution,
 		   bool  clamp /*=true*/ );
 
-	/** Deallocates camera's tween objects.
+	/** Releases the camera's tween back to the pool.
 	*/
 	~Camera();
 
@@ -70,7 +74,9 @@ public:
 	void animateTo(const sf::Vector2f& target);
 	void clampTo(const sf::Vector2u& backgroundSize, const sf::Vector2f& resolution);
 	bool isAnimating() const;
-	void update(float dt, const Circle& player);
+	// Follows the player while no tween is running; the tween itself is
+	// advanced by the pool's owner before this is called
+	void update(const Circle& player);
 	void incrementDuration(float i);
 
 	/** Accessors
@@ -78,9 +84,17 @@ public:
 	void setInterpolation(InterpFunc interp);
 	InterpFunc getInterpolation() const;
 
+	/** Animates with a shared spring instead of the interpolation function;
+	* the tween duration then comes from the spring. Pass nullptr to go back.
+	*/
+	void setSpring(const animation::Spring* spring);
+
 	sf::Vector2f getPosition() const;
 	void setPosition(const sf::Vector2f& pos);
 
+	// Velocity of the camera tween in pixels per second; zero when idle
+	sf::Vector2f getVelocity() const;
+
 	float getDuration() const;
 	void setDuration(float duration);
 };
@@ -3,6 +3,8 @@
 
 #include <SFML/Graphics.hpp>
 #include "engine/tween.hpp"
+#include "engine/tween_manager.hpp"
+#include "engine/tween_pool.hpp"
 
 using namespace sf;
 using namespace std;
@@ -17,8 +19,13 @@ private:
 	static const float DEFAULT_LINE_THICKNESS;
 	static const float MOVE_SPEED;
 
-	Tween* m_tweenA;
-	Tween* m_tweenB;
+	// Demo tween, in a pool owned by the demo (not owned)
+	TweenPool<Tween>* m_tweens;
+	TweenHandle m_demoTween;
+
+	// Manager running the spawned tweens (not owned); null until the
+	// first spawn
+	TweenManager* m_spawnTweens;
 
 	bool m_active;
 	bool m_moveLeft;
@@ -29,6 +36,14 @@ private:
 private:
 	void initialise();
 
+	// The demo tween, created again if it finished and was recycled;
+	// null before createDemoTween()
+	Tween* demoTween();
+
+	// Removes spawned tweens from m_position.x so the demo tween alone
+	// drives it
+	void stopSpawnedTweens();
+
 public:
 	Circle();
 	Circle(const Color& color);
@@ -63,16 +78,21 @@ public:
 	void setActive(bool b);
 	bool isActive() const;
 
-	// Tween API
-	void createDemoTween(InterpFunc func=InterpFunc::QuartEaseOut);
+	// Tween API; the demo tween lives in tweens, which must outlive the
+	// circle and is updated by its owner. Starting or resetting it stops
+	// any spawned tween on the same position.
+	void createDemoTween(TweenPool<Tween>& tweens, InterpFunc func=InterpFunc::QuartEaseOut);
 	void startStopTweenToggle();
 	void startTween();
 	void stopTween();
 	void resetTween(bool start);
 
-	// Dynamic tweens (custom animations for class)
-	void spawnInTween();
-	void spawnOutTween();
+	// Dynamic tweens (custom animations for class), run by a shared
+	// manager; they stop the demo tween and any spawned tween before them
+	// and resume from the circle's position along their path. tweens must
+	// outlive later calls to the demo tween API and the circle's destructor.
+	void spawnInTween(TweenManager& tweens);
+	void spawnOutTween(TweenManager& tweens);
 };
 
 #endif
\ No newline at end of file
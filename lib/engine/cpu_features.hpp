@@ -0,0 +1,41 @@
+#ifndef CpuFeatures_Hpp
+#define CpuFeatures_Hpp
+
+#include <string>
+
+namespace animation {
+
+	// Instruction sets the batch easing kernels can be built for
+	enum class InstructionSet {
+		Scalar = 0,
+		SSE2 = 1,
+		AVX2 = 2,		// with FMA
+		AVX512 = 3,		// AVX-512F
+		NEON = 4
+	};
+
+	/**
+	Instruction sets supported by the CPU running the program.
+
+	Detected once on first use: CPUID (and XGETBV, so the OS must also
+	save the wider registers) on x86, the kernel hwcaps on 32-bit ARM
+	Linux. NEON is part of AArch64 and always reported there.
+	*/
+
+	class CpuFeatures {
+	public:
+		CpuFeatures() = delete;
+		CpuFeatures(const CpuFeatures&) = delete;
+		CpuFeatures& operator= (const CpuFeatures&) = delete;
+
+		static bool supports(InstructionSet isa);
+
+		// "SSE2", "AVX2", ...
+		static const char* name(InstructionSet isa);
+
+		// Every supported set for diagnostics, e.g. "x86-64: SSE2 AVX2 AVX512"
+		static std::string describe();
+	};
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef CubicBezier_Hpp
+#define CubicBezier_Hpp
+
+#include <cstddef>
+
+namespace animation {
+
+	/**
+	CSS style cubic-bezier(x1, y1, x2, y2) easing curve.
+
+	The curve runs from (0, 0) to (1, 1) through the control points
+	(x1, y1) and (x2, y2). Evaluating it means finding the curve parameter
+	whose x equals the time, then returning its y. The constructor samples
+	x at 11 evenly spaced parameters; apply() picks the sample interval,
+	refines the parameter with Newton-Raphson and falls back to bisection
+	where the slope is too flat for Newton to converge.
+
+	Curves are immutable after construction and hold no heap memory, so a
+	single instance can drive any number of tweens without per-call setup.
+	x1 and x2 are clamped to [0, 1] so the curve stays a function of time;
+	y1 and y2 are free, which allows overshoot. Where dx/ds reaches zero,
+	e.g. cubic-bezier(1, 0, 0, 1) at t = 0.5, accuracy is limited by
+	SUBDIVISION_PRECISION as in browser implementations.
+	*/
+
+	class CubicBezier {
+	private:
+		static const int SAMPLE_COUNT = 11;
+
+		float m_x1, m_y1, m_x2, m_y2;
+		float m_samples[SAMPLE_COUNT];	// x at parameter i / (SAMPLE_COUNT - 1)
+
+		float solveParameter(float x) const;
+
+	public:
+		static const int   NEWTON_ITERATIONS;		// upper bound; stops once x is within SUBDIVISION_PRECISION
+		static const float NEWTON_MIN_SLOPE;
+		static const float SUBDIVISION_PRECISION;
+		static const int   SUBDIVISION_MAX_ITERATIONS;
+
+		CubicBezier(float x1, float y1, float x2, float y2);
+
+		// Normalized evaluation; t outside [0, 1] returns the end points
+		float apply(float t) const;
+
+		// Same as the Interpolate (t, b, c, d) overloads
+		float apply(float t, float b, float c, float d) const;
+
+		// First and second derivative per unit of normalized time
+		float velocity(float t) const;
+		float acceleration(float t) const;
+
+		// Normalized time at which the curve reaches value. Exact for curves
+		// with y1 and y2 in [0, 1]; overshooting curves return one crossing.
+		float inverse(float value) const;
+
+		// out[i] = apply(t[i]) for count normalized times
+		void evaluate(const float* t, float* out, std::size_t count) const;
+
+		float x1() const { return m_x1; }
+		float y1() const { return m_y1; }
+		float x2() const { return m_x2; }
+		float y2() const { return m_y2; }
+
+		// The CSS named timing functions
+		static const CubicBezier Ease;
+		static const CubicBezier EaseIn;
+		static const CubicBezier EaseOut;
+		static const CubicBezier EaseInOut;
+	};
+}
+
+#endif
@@ -0,0 +1,706 @@
+#ifndef Easing_Hpp
+#define Easing_Hpp
+
+#include <cmath>
+#include "engine/interp_func.hpp"
+#include "engine/fast_math.hpp"
+
+namespace animation {
+namespace easing {
+
+	/**
+	Header-only easing functors, one per InterpFunc.
+
+	apply(t) takes a normalized time between 0 and 1. apply(t, b, c, d)
+	takes elapsed time t, start value b, change in value c and duration d.
+	Polynomial curves are constexpr; curves that need sin, pow or sqrt are
+	plain inline functions. When the curve is known at compile time use
+	ease<InterpFunc::...>(t), which inlines to the curve's arithmetic.
+
+	Sine, expo and elastic curves are templates over a math policy from
+	engine/fast_math.hpp; the plain names (SineEaseIn, ...) use ExactMath.
+
+	velocity(t) and acceleration(t) are the first and second derivatives
+	of apply(t) with respect to normalized time. The expo and elastic
+	curves snap to exactly 0 and 1 at the ends; the derivatives describe
+	the smooth curve and ignore that jump. Circular curves turn vertical
+	at their ends, so their derivatives there are large but finite.
+	*/
+
+	constexpr float PI = 3.14159265f;
+	constexpr float LN2 = 0.693147181f;
+	constexpr float BACK_C1 = 1.70158f;
+	constexpr float ELASTIC_C4 = (2.f * PI) / 3.f;
+	constexpr float ELASTIC_C5 = (2.f * PI) / 4.5f;
+
+	// sqrt(x) kept away from zero where the circular curves turn vertical
+	inline float circRoot(float x) {
+		return std::sqrt(x > 1e-8f ? x : 1e-8f);
+	}
+
+	/** Derivatives of 2^e * sin(phase), where e and phase are linear in t.
+
+	k is d(e)/dt * ln 2 and omega is d(phase)/dt. Shared by the elastic curves.
+	*/
+	template<class M>
+	struct DampedSine {
+		static float velocity(float k, float e, float omega, float phase) {
+			return M::exp2(e) * (k * M::sin(phase) + omega * M::cos(phase));
+		}
+		static float acceleration(float k, float e, float omega, float phase) {
+			return M::exp2(e) * ((k * k - omega * omega) * M::sin(phase) + 2.f * k * omega * M::cos(phase));
+		}
+	};
+
+	struct Linear {
+		static constexpr float apply(float t) { return t; }
+		static constexpr float apply(float t, float b, float c, float d) { return c * t / d + b; }
+		static constexpr float velocity(float t) { return 1.f; }
+		static constexpr float acceleration(float t) { return 0.f; }
+	};
+
+	// ------------------------------------------------------------------
+	// Polynomial curves
+	// ------------------------------------------------------------------
+
+	struct QuadEaseIn {
+		static constexpr float apply(float t) { return t * t; }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return 2.f * t; }
+		static constexpr float acceleration(float t) { return 2.f; }
+	};
+
+	struct QuadEaseOut {
+		static constexpr float apply(float t) { return 1.f - (1.f - t) * (1.f - t); }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return 2.f * (1.f - t); }
+		static constexpr float acceleration(float t) { return -2.f; }
+	};
+
+	struct QuadEaseInOut {
+		static constexpr float apply(float t) {
+			return t < 0.5f
+				? 2.f * t * t
+				: 1.f - (-2.f * t + 2.f) * (-2.f * t + 2.f) / 2.f;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return t < 0.5f ? 4.f * t : 4.f * (1.f - t); }
+		static constexpr float acceleration(float t) { return t < 0.5f ? 4.f : -4.f; }
+	};
+
+	struct CubicEaseIn {
+		static constexpr float apply(float t) { return t * t * t; }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return 3.f * t * t; }
+		static constexpr float acceleration(float t) { return 6.f * t; }
+	};
+
+	struct CubicEaseOut {
+		static constexpr float apply(float t) {
+			float w = 1.f - t;
+			return 1.f - w * w * w;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			float w = 1.f - t;
+			return 3.f * w * w;
+		}
+		static constexpr float acceleration(float t) { return -6.f * (1.f - t); }
+	};
+
+	struct CubicEaseInOut {
+		static constexpr float apply(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f
+				? 4.f * t * t * t
+				: 1.f - w * w * w / 2.f;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f ? 12.f * t * t : 3.f * w * w;
+		}
+		static constexpr float acceleration(float t) { return t < 0.5f ? 24.f * t : -12.f * (-2.f * t + 2.f); }
+	};
+
+	struct QuartEaseIn {
+		static constexpr float apply(float t) { return t * t * t * t; }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return 4.f * t * t * t; }
+		static constexpr float acceleration(float t) { return 12.f * t * t; }
+	};
+
+	struct QuartEaseOut {
+		static constexpr float apply(float t) {
+			float w = 1.f - t;
+			return 1.f - w * w * w * w;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			float w = 1.f - t;
+			return 4.f * w * w * w;
+		}
+		static constexpr float acceleration(float t) {
+			float w = 1.f - t;
+			return -12.f * w * w;
+		}
+	};
+
+	struct QuartEaseInOut {
+		static constexpr float apply(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f
+				? 8.f * t * t * t * t
+				: 1.f - w * w * w * w / 2.f;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f ? 32.f * t * t * t : 4.f * w * w * w;
+		}
+		static constexpr float acceleration(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f ? 96.f * t * t : -24.f * w * w;
+		}
+	};
+
+	struct QuintEaseIn {
+		static constexpr float apply(float t) { return t * t * t * t * t; }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return 5.f * t * t * t * t; }
+		static constexpr float acceleration(float t) { return 20.f * t * t * t; }
+	};
+
+	struct QuintEaseOut {
+		static constexpr float apply(float t) {
+			float w = 1.f - t;
+			return 1.f - w * w * w * w * w;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			float w = 1.f - t;
+			return 5.f * w * w * w * w;
+		}
+		static constexpr float acceleration(float t) {
+			float w = 1.f - t;
+			return -20.f * w * w * w;
+		}
+	};
+
+	struct QuintEaseInOut {
+		static constexpr float apply(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f
+				? 16.f * t * t * t * t * t
+				: 1.f - w * w * w * w * w / 2.f;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f ? 80.f * t * t * t * t : 5.f * w * w * w * w;
+		}
+		static constexpr float acceleration(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f ? 320.f * t * t * t : -40.f * w * w * w;
+		}
+	};
+
+	// ------------------------------------------------------------------
+	// Sinusoidal, exponential and circular curves
+	// ------------------------------------------------------------------
+
+	template<class M>
+	struct SineEaseInT {
+		static float apply(float t) { return 1.f - M::cos((t * PI) / 2.f); }
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) { return (PI / 2.f) * M::sin((t * PI) / 2.f); }
+		static float acceleration(float t) { return (PI * PI / 4.f) * M::cos((t * PI) / 2.f); }
+	};
+	typedef SineEaseInT<fastmath::ExactMath> SineEaseIn;
+
+	template<class M>
+	struct SineEaseOutT {
+		static float apply(float t) { return M::sin((t * PI) / 2.f); }
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) { return (PI / 2.f) * M::cos((t * PI) / 2.f); }
+		static float acceleration(float t) { return -(PI * PI / 4.f) * M::sin((t * PI) / 2.f); }
+	};
+	typedef SineEaseOutT<fastmath::ExactMath> SineEaseOut;
+
+	template<class M>
+	struct SineEaseInOutT {
+		static float apply(float t) { return -(M::cos(PI * t) - 1.f) / 2.f; }
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) { return (PI / 2.f) * M::sin(PI * t); }
+		static float acceleration(float t) { return (PI * PI / 2.f) * M::cos(PI * t); }
+	};
+	typedef SineEaseInOutT<fastmath::ExactMath> SineEaseInOut;
+
+	// The (t, b, c, d) expo forms do not snap to exactly 0 and 1 at the ends
+	template<class M>
+	struct ExpoEaseInT {
+		static float apply(float t) {
+			return t == 0.f ? 0.f : M::exp2(10.f * t - 10.f);
+		}
+		static float apply(float t, float b, float c, float d) {
+			return c * M::exp2(10.f * (t / d - 1.f)) + b;
+		}
+		static float velocity(float t) { return 10.f * LN2 * M::exp2(10.f * t - 10.f); }
+		static float acceleration(float t) { return 100.f * LN2 * LN2 * M::exp2(10.f * t - 10.f); }
+	};
+	typedef ExpoEaseInT<fastmath::ExactMath> ExpoEaseIn;
+
+	template<class M>
+	struct ExpoEaseOutT {
+		static float apply(float t) {
+			return t == 1.f ? 1.f : 1.f - M::exp2(-10.f * t);
+		}
+		static float apply(float t, float b, float c, float d) {
+			return c * (-M::exp2(-10.f * t / d) + 1.f) + b;
+		}
+		static float velocity(float t) { return 10.f * LN2 * M::exp2(-10.f * t); }
+		static float acceleration(float t) { return -100.f * LN2 * LN2 * M::exp2(-10.f * t); }
+	};
+	typedef ExpoEaseOutT<fastmath::ExactMath> ExpoEaseOut;
+
+	template<class M>
+	struct ExpoEaseInOutT {
+		static float apply(float t) {
+			if (t == 0.f) return 0.f;
+			if (t == 1.f) return 1.f;
+			return t < 0.5f
+				? M::exp2(20.f * t - 10.f) / 2.f
+				: (2.f - M::exp2(-20.f * t + 10.f)) / 2.f;
+		}
+		static float apply(float t, float b, float c, float d) {
+			t /= d / 2.f;
+			if (t < 1.f)
+				return c / 2.f * M::exp2(10.f * (t - 1.f)) + b;
+			t--;
+			return c / 2.f * (-M::exp2(-10.f * t) + 2.f) + b;
+		}
+		static float velocity(float t) {
+			return t < 0.5f
+				? 10.f * LN2 * M::exp2(20.f * t - 10.f)
+				: 10.f * LN2 * M::exp2(-20.f * t + 10.f);
+		}
+		static float acceleration(float t) {
+			return t < 0.5f
+				? 200.f * LN2 * LN2 * M::exp2(20.f * t - 10.f)
+				: -200.f * LN2 * LN2 * M::exp2(-20.f * t + 10.f);
+		}
+	};
+	typedef ExpoEaseInOutT<fastmath::ExactMath> ExpoEaseInOut;
+
+	struct CircEaseIn {
+		static float apply(float t) { return 1.f - std::sqrt(1.f - t * t); }
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) {
+			float r = circRoot(1.f - t * t);
+			return t / r;
+		}
+		static float acceleration(float t) {
+			float r = circRoot(1.f - t * t);
+			return 1.f / (r * r * r);
+		}
+	};
+
+	struct CircEaseOut {
+		static float apply(float t) { return std::sqrt(1.f - (t - 1.f) * (t - 1.f)); }
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) {
+			float w = t - 1.f;
+			return -w / circRoot(1.f - w * w);
+		}
+		static float acceleration(float t) {
+			float w = t - 1.f;
+			float r = circRoot(1.f - w * w);
+			return -1.f / (r * r * r);
+		}
+	};
+
+	struct CircEaseInOut {
+		static float apply(float t) {
+			float w = -2.f * t + 2.f;
+			return t < 0.5f
+				? (1.f - std::sqrt(1.f - 4.f * t * t)) / 2.f
+				: (std::sqrt(1.f - w * w) + 1.f) / 2.f;
+		}
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) {
+			float s = t < 0.5f ? 2.f * t : -2.f * t + 2.f;
+			return s / circRoot(1.f - s * s);
+		}
+		static float acceleration(float t) {
+			float s = t < 0.5f ? 2.f * t : -2.f * t + 2.f;
+			float r = circRoot(1.f - s * s);
+			return (t < 0.5f ? 2.f : -2.f) / (r * r * r);
+		}
+	};
+
+	// ------------------------------------------------------------------
+	// Back, elastic and bounce curves
+	// ------------------------------------------------------------------
+
+	// c1 controls the amount of pull back / over throw
+	struct BackEaseIn {
+		static constexpr float apply(float t, float c1) {
+			return (c1 + 1.f) * t * t * t - c1 * t * t;
+		}
+		static constexpr float apply(float t) { return apply(t, BACK_C1); }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return 3.f * (BACK_C1 + 1.f) * t * t - 2.f * BACK_C1 * t; }
+		static constexpr float acceleration(float t) { return 6.f * (BACK_C1 + 1.f) * t - 2.f * BACK_C1; }
+	};
+
+	struct BackEaseOut {
+		static constexpr float apply(float t, float c1) {
+			float w = t - 1.f;
+			return 1.f + (c1 + 1.f) * w * w * w + c1 * w * w;
+		}
+		static constexpr float apply(float t) { return apply(t, BACK_C1); }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			float w = t - 1.f;
+			return 3.f * (BACK_C1 + 1.f) * w * w + 2.f * BACK_C1 * w;
+		}
+		static constexpr float acceleration(float t) { return 6.f * (BACK_C1 + 1.f) * (t - 1.f) + 2.f * BACK_C1; }
+	};
+
+	struct BackEaseInOut {
+		static constexpr float apply(float t, float c1) {
+			float c2 = c1 * 1.525f;
+			float s = 2.f * t;
+			float w = 2.f * t - 2.f;
+			return t < 0.5f
+				? (s * s * ((c2 + 1.f) * s - c2)) / 2.f
+				: (w * w * ((c2 + 1.f) * w + c2) + 2.f) / 2.f;
+		}
+		static constexpr float apply(float t) { return apply(t, BACK_C1); }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			const float c2 = BACK_C1 * 1.525f;
+			float s = t < 0.5f ? 2.f * t : 2.f * t - 2.f;
+			float k = t < 0.5f ? -2.f * c2 : 2.f * c2;
+			return 3.f * (c2 + 1.f) * s * s + k * s;
+		}
+		static constexpr float acceleration(float t) {
+			const float c2 = BACK_C1 * 1.525f;
+			float s = t < 0.5f ? 2.f * t : 2.f * t - 2.f;
+			float k = t < 0.5f ? -2.f * c2 : 2.f * c2;
+			return 2.f * (6.f * (c2 + 1.f) * s + k);
+		}
+	};
+
+	template<class M>
+	struct ElasticEaseInT {
+		static float apply(float t) {
+			return t == 0.f
+				? 0.f
+				: t == 1.f
+					? 1.f
+					: -M::exp2(10.f * t - 10.f) * M::sin((t * 10.f - 10.75f) * ELASTIC_C4);
+		}
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) {
+			return -DampedSine<M>::velocity(10.f * LN2, 10.f * t - 10.f, 10.f * ELASTIC_C4, (t * 10.f - 10.75f) * ELASTIC_C4);
+		}
+		static float acceleration(float t) {
+			return -DampedSine<M>::acceleration(10.f * LN2, 10.f * t - 10.f, 10.f * ELASTIC_C4, (t * 10.f - 10.75f) * ELASTIC_C4);
+		}
+	};
+	typedef ElasticEaseInT<fastmath::ExactMath> ElasticEaseIn;
+
+	template<class M>
+	struct ElasticEaseOutT {
+		static float apply(float t) {
+			return t == 0.f
+				? 0.f
+				: t == 1.f
+					? 1.f
+					: M::exp2(-10.f * t) * M::sin((t * 10.f - 0.75f) * ELASTIC_C4) + 1.f;
+		}
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) {
+			return DampedSine<M>::velocity(-10.f * LN2, -10.f * t, 10.f * ELASTIC_C4, (t * 10.f - 0.75f) * ELASTIC_C4);
+		}
+		static float acceleration(float t) {
+			return DampedSine<M>::acceleration(-10.f * LN2, -10.f * t, 10.f * ELASTIC_C4, (t * 10.f - 0.75f) * ELASTIC_C4);
+		}
+	};
+	typedef ElasticEaseOutT<fastmath::ExactMath> ElasticEaseOut;
+
+	template<class M>
+	struct ElasticEaseInOutT {
+		static float apply(float t) {
+			return t == 0.f
+				? 0.f
+				: t == 1.f
+					? 1.f
+					: t < 0.5f
+						? -(M::exp2(20.f * t - 10.f) * M::sin((20.f * t - 11.125f) * ELASTIC_C5)) / 2.f
+						: (M::exp2(-20.f * t + 10.f) * M::sin((20.f * t - 11.125f) * ELASTIC_C5)) / 2.f + 1.f;
+		}
+		static float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static float velocity(float t) {
+			float phase = (20.f * t - 11.125f) * ELASTIC_C5;
+			return t < 0.5f
+				? -DampedSine<M>::velocity(20.f * LN2, 20.f * t - 10.f, 20.f * ELASTIC_C5, phase) / 2.f
+				: DampedSine<M>::velocity(-20.f * LN2, -20.f * t + 10.f, 20.f * ELASTIC_C5, phase) / 2.f;
+		}
+		static float acceleration(float t) {
+			float phase = (20.f * t - 11.125f) * ELASTIC_C5;
+			return t < 0.5f
+				? -DampedSine<M>::acceleration(20.f * LN2, 20.f * t - 10.f, 20.f * ELASTIC_C5, phase) / 2.f
+				: DampedSine<M>::acceleration(-20.f * LN2, -20.f * t + 10.f, 20.f * ELASTIC_C5, phase) / 2.f;
+		}
+	};
+	typedef ElasticEaseInOutT<fastmath::ExactMath> ElasticEaseInOut;
+
+	struct BounceEaseOut {
+		static constexpr float apply(float t) {
+			const float n1 = 7.5625f;
+			const float d1 = 2.75f;
+
+			if (t < 1.f / d1) {
+				return n1 * t * t;
+			} else if (t < 2.f / d1) {
+				t -= 1.5f / d1;
+				return n1 * t * t + 0.75f;
+			} else if (t < 2.5f / d1) {
+				t -= 2.25f / d1;
+				return n1 * t * t + 0.9375f;
+			}
+			t -= 2.625f / d1;
+			return n1 * t * t + 0.984375f;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		// Each segment is a parabola n1 * (t - offset)^2 + height
+		static constexpr float velocity(float t) {
+			const float n1 = 7.5625f;
+			const float d1 = 2.75f;
+
+			if (t < 1.f / d1)
+				return 2.f * n1 * t;
+			if (t < 2.f / d1)
+				return 2.f * n1 * (t - 1.5f / d1);
+			if (t < 2.5f / d1)
+				return 2.f * n1 * (t - 2.25f / d1);
+			return 2.f * n1 * (t - 2.625f / d1);
+		}
+		static constexpr float acceleration(float) { return 2.f * 7.5625f; }
+	};
+
+	struct BounceEaseIn {
+		static constexpr float apply(float t) { return 1.f - BounceEaseOut::apply(1.f - t); }
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) { return BounceEaseOut::velocity(1.f - t); }
+		static constexpr float acceleration(float t) { return -BounceEaseOut::acceleration(1.f - t); }
+	};
+
+	struct BounceEaseInOut {
+		static constexpr float apply(float t) {
+			return t < 0.5f
+				? (1.f - BounceEaseOut::apply(1.f - 2.f * t)) / 2.f
+				: (1.f + BounceEaseOut::apply(2.f * t - 1.f)) / 2.f;
+		}
+		static constexpr float apply(float t, float b, float c, float d) { return c * apply(t / d) + b; }
+		static constexpr float velocity(float t) {
+			return t < 0.5f
+				? BounceEaseOut::velocity(1.f - 2.f * t)
+				: BounceEaseOut::velocity(2.f * t - 1.f);
+		}
+		static constexpr float acceleration(float t) {
+			return t < 0.5f
+				? -2.f * BounceEaseOut::acceleration(1.f - 2.f * t)
+				: 2.f * BounceEaseOut::acceleration(2.f * t - 1.f);
+		}
+	};
+
+	// ------------------------------------------------------------------
+	// InterpFunc to functor mapping
+	// ------------------------------------------------------------------
+
+	template<InterpFunc F, class M = fastmath::ExactMath> struct Curve { typedef QuartEaseOut type; };
+
+	template<class M> struct Curve<InterpFunc::Linear, M>           { typedef Linear type; };
+	template<class M> struct Curve<InterpFunc::QuadEaseIn, M>       { typedef QuadEaseIn type; };
+	template<class M> struct Curve<InterpFunc::QuadEaseOut, M>      { typedef QuadEaseOut type; };
+	template<class M> struct Curve<InterpFunc::QuadEaseInOut, M>    { typedef QuadEaseInOut type; };
+	template<class M> struct Curve<InterpFunc::CubicEaseIn, M>      { typedef CubicEaseIn type; };
+	template<class M> struct Curve<InterpFunc::CubicEaseOut, M>     { typedef CubicEaseOut type; };
+	template<class M> struct Curve<InterpFunc::CubicEaseInOut, M>   { typedef CubicEaseInOut type; };
+	template<class M> struct Curve<InterpFunc::QuartEaseIn, M>      { typedef QuartEaseIn type; };
+	template<class M> struct Curve<InterpFunc::QuartEaseOut, M>     { typedef QuartEaseOut type; };
+	template<class M> struct Curve<InterpFunc::QuartEaseInOut, M>   { typedef QuartEaseInOut type; };
+	template<class M> struct Curve<InterpFunc::QuintEaseIn, M>      { typedef QuintEaseIn type; };
+	template<class M> struct Curve<InterpFunc::QuintEaseOut, M>     { typedef QuintEaseOut type; };
+	template<class M> struct Curve<InterpFunc::QuintEaseInOut, M>   { typedef QuintEaseInOut type; };
+	template<class M> struct Curve<InterpFunc::SineEaseIn, M>       { typedef SineEaseInT<M> type; };
+	template<class M> struct Curve<InterpFunc::SineEaseOut, M>      { typedef SineEaseOutT<M> type; };
+	template<class M> struct Curve<InterpFunc::SineEaseInOut, M>    { typedef SineEaseInOutT<M> type; };
+	template<class M> struct Curve<InterpFunc::ExpoEaseIn, M>       { typedef ExpoEaseInT<M> type; };
+	template<class M> struct Curve<InterpFunc::ExpoEaseOut, M>      { typedef ExpoEaseOutT<M> type; };
+	template<class M> struct Curve<InterpFunc::ExpoEaseInOut, M>    { typedef ExpoEaseInOutT<M> type; };
+	template<class M> struct Curve<InterpFunc::CircEaseIn, M>       { typedef CircEaseIn type; };
+	template<class M> struct Curve<InterpFunc::CircEaseOut, M>      { typedef CircEaseOut type; };
+	template<class M> struct Curve<InterpFunc::CircEaseInOut, M>    { typedef CircEaseInOut type; };
+	template<class M> struct Curve<InterpFunc::BackEaseIn, M>       { typedef BackEaseIn type; };
+	template<class M> struct Curve<InterpFunc::BackEaseOut, M>      { typedef BackEaseOut type; };
+	template<class M> struct Curve<InterpFunc::BackEaseInOut, M>    { typedef BackEaseInOut type; };
+	template<class M> struct Curve<InterpFunc::ElasticEaseIn, M>    { typedef ElasticEaseInT<M> type; };
+	template<class M> struct Curve<InterpFunc::ElasticEaseOut, M>   { typedef ElasticEaseOutT<M> type; };
+	template<class M> struct Curve<InterpFunc::ElasticEaseInOut, M> { typedef ElasticEaseInOutT<M> type; };
+	template<class M> struct Curve<InterpFunc::BounceEaseIn, M>     { typedef BounceEaseIn type; };
+	template<class M> struct Curve<InterpFunc::BounceEaseOut, M>    { typedef BounceEaseOut type; };
+	template<class M> struct Curve<InterpFunc::BounceEaseInOut, M>  { typedef BounceEaseInOut type; };
+
+	// Compile-time dispatch, e.g. ease<InterpFunc::QuartEaseOut>(t)
+	// or ease<InterpFunc::SineEaseIn, fastmath::FastMath>(t)
+	template<InterpFunc F, class M = fastmath::ExactMath>
+	inline constexpr float ease(float t) {
+		return Curve<F, M>::type::apply(t);
+	}
+
+	template<InterpFunc F, class M = fastmath::ExactMath>
+	inline constexpr float ease(float t, float b, float c, float d) {
+		return Curve<F, M>::type::apply(t, b, c, d);
+	}
+
+	/** Calls visitor(Functor()) with the functor matching a runtime InterpFunc.
+
+	Lets callers that only know the curve at run time switch once and keep
+	the functor body inlined. M selects the math policy used by the sine,
+	expo and elastic curves. Unknown values fall back to QuartEaseOut.
+	*/
+	template<class M = fastmath::ExactMath, class Visitor>
+	inline void dispatch(InterpFunc func, Visitor&& visitor) {
+		switch (func) {
+		case InterpFunc::Linear:           visitor(Linear()); break;
+		case InterpFunc::QuadEaseIn:       visitor(QuadEaseIn()); break;
+		case InterpFunc::QuadEaseOut:      visitor(QuadEaseOut()); break;
+		case InterpFunc::QuadEaseInOut:    visitor(QuadEaseInOut()); break;
+		case InterpFunc::CubicEaseIn:      visitor(CubicEaseIn()); break;
+		case InterpFunc::CubicEaseOut:     visitor(CubicEaseOut()); break;
+		case InterpFunc::CubicEaseInOut:   visitor(CubicEaseInOut()); break;
+		case InterpFunc::QuartEaseIn:      visitor(QuartEaseIn()); break;
+		case InterpFunc::QuartEaseOut:     visitor(QuartEaseOut()); break;
+		case InterpFunc::QuartEaseInOut:   visitor(QuartEaseInOut()); break;
+		case InterpFunc::QuintEaseIn:      visitor(QuintEaseIn()); break;
+		case InterpFunc::QuintEaseOut:     visitor(QuintEaseOut()); break;
+		case InterpFunc::QuintEaseInOut:   visitor(QuintEaseInOut()); break;
+		case InterpFunc::SineEaseIn:       visitor(SineEaseInT<M>()); break;
+		case InterpFunc::SineEaseOut:      visitor(SineEaseOutT<M>()); break;
+		case InterpFunc::SineEaseInOut:    visitor(SineEaseInOutT<M>()); break;
+		case InterpFunc::ExpoEaseIn:       visitor(ExpoEaseInT<M>()); break;
+		case InterpFunc::ExpoEaseOut:      visitor(ExpoEaseOutT<M>()); break;
+		case InterpFunc::ExpoEaseInOut:    visitor(ExpoEaseInOutT<M>()); break;
+		case InterpFunc::CircEaseIn:       visitor(CircEaseIn()); break;
+		case InterpFunc::CircEaseOut:      visitor(CircEaseOut()); break;
+		case InterpFunc::CircEaseInOut:    visitor(CircEaseInOut()); break;
+		case InterpFunc::BackEaseIn:       visitor(BackEaseIn()); break;
+		case InterpFunc::BackEaseOut:      visitor(BackEaseOut()); break;
+		case InterpFunc::BackEaseInOut:    visitor(BackEaseInOut()); break;
+		case InterpFunc::ElasticEaseIn:    visitor(ElasticEaseInT<M>()); break;
+		case InterpFunc::ElasticEaseOut:   visitor(ElasticEaseOutT<M>()); break;
+		case InterpFunc::ElasticEaseInOut: visitor(ElasticEaseInOutT<M>()); break;
+		case InterpFunc::BounceEaseIn:     visitor(BounceEaseIn()); break;
+		case InterpFunc::BounceEaseOut:    visitor(BounceEaseOut()); break;
+		case InterpFunc::BounceEaseInOut:  visitor(BounceEaseInOut()); break;
+		default:                           visitor(QuartEaseOut()); break;
+		}
+	}
+
+	// Runtime dispatch helpers for a single evaluation
+	inline float evaluate(InterpFunc func, float t) {
+		float result = 0.f;
+		dispatch(func, [&](auto curve) { result = decltype(curve)::apply(t); });
+		return result;
+	}
+
+	inline float evaluate(InterpFunc func, float t, float b, float c, float d) {
+		float result = 0.f;
+		dispatch(func, [&](auto curve) { result = decltype(curve)::apply(t, b, c, d); });
+		return result;
+	}
+
+	// Runtime dispatch with a runtime math policy; Default behaves as Exact
+	inline float evaluate(InterpFunc func, EasingPrecision precision, float t) {
+		float result = 0.f;
+		auto visitor = [&](auto curve) { result = decltype(curve)::apply(t); };
+
+		switch (precision) {
+		case EasingPrecision::Fast:    dispatch<fastmath::FastMath>(func, visitor); break;
+		case EasingPrecision::Fastest: dispatch<fastmath::FastestMath>(func, visitor); break;
+		default:                       dispatch(func, visitor); break;
+		}
+
+		return result;
+	}
+
+	inline float evaluate(InterpFunc func, EasingPrecision precision, float t, float b, float c, float d) {
+		float result = 0.f;
+		auto visitor = [&](auto curve) { result = decltype(curve)::apply(t, b, c, d); };
+
+		switch (precision) {
+		case EasingPrecision::Fast:    dispatch<fastmath::FastMath>(func, visitor); break;
+		case EasingPrecision::Fastest: dispatch<fastmath::FastestMath>(func, visitor); break;
+		default:                       dispatch(func, visitor); break;
+		}
+
+		return result;
+	}
+
+	// ------------------------------------------------------------------
+	// Derivatives
+	// ------------------------------------------------------------------
+
+	// d/dt and d2/dt2 of ease<F>(t), e.g. velocity<InterpFunc::QuadEaseIn>(t)
+	template<InterpFunc F, class M = fastmath::ExactMath>
+	inline constexpr float velocity(float t) {
+		return Curve<F, M>::type::velocity(t);
+	}
+
+	template<InterpFunc F, class M = fastmath::ExactMath>
+	inline constexpr float acceleration(float t) {
+		return Curve<F, M>::type::acceleration(t);
+	}
+
+	// Value units per unit of t for the (t, b, c, d) form; b does not affect the slope
+	template<InterpFunc F, class M = fastmath::ExactMath>
+	inline constexpr float velocity(float t, float, float c, float d) {
+		return c / d * Curve<F, M>::type::velocity(t / d);
+	}
+
+	template<InterpFunc F, class M = fastmath::ExactMath>
+	inline constexpr float acceleration(float t, float, float c, float d) {
+		return c / (d * d) * Curve<F, M>::type::acceleration(t / d);
+	}
+
+	template<class M = fastmath::ExactMath>
+	inline float velocity(InterpFunc func, float t) {
+		float result = 0.f;
+		dispatch<M>(func, [&](auto curve) { result = decltype(curve)::velocity(t); });
+		return result;
+	}
+
+	template<class M = fastmath::ExactMath>
+	inline float acceleration(InterpFunc func, float t) {
+		float result = 0.f;
+		dispatch<M>(func, [&](auto curve) { result = decltype(curve)::acceleration(t); });
+		return result;
+	}
+
+	template<class M = fastmath::ExactMath>
+	inline float velocity(InterpFunc func, float t, float, float c, float d) {
+		return c / d * velocity<M>(func, t / d);
+	}
+
+	template<class M = fastmath::ExactMath>
+	inline float acceleration(InterpFunc func, float t, float, float c, float d) {
+		return c / (d * d) * acceleration<M>(func, t / d);
+	}
+}
+}
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef EasingExpression_Hpp
+#define EasingExpression_Hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "engine/interp_func.hpp"
+
+namespace animation {
+
+	/**
+	Composite easing curve built from InterpFunc leaves.
+
+	Expressions are immutable values; every combinator returns a new
+	expression and shares the operands, so building a curve never copies
+	a subtree. Nothing is evaluated here: compile the expression into a
+	CompiledEasing once and evaluate that.
+
+	    // mirror(easeOutBounce), scaled by 0.5, crossfaded with easeInSine
+	    auto curve = EasingExpression::blend(
+	        EasingExpression::curve(InterpFunc::BounceEaseOut).mirror().scale(0.5f),
+	        EasingExpression::curve(InterpFunc::SineEaseIn),
+	        EasingExpression::time());
+	*/
+
+	class EasingExpression {
+	public:
+		struct Node;
+
+	private:
+		std::shared_ptr<const Node> m_node;
+
+		explicit EasingExpression(std::shared_ptr<const Node> node);
+
+	public:
+		// ease(t) for a built-in curve
+		static EasingExpression curve(InterpFunc func);
+
+		// t itself, e.g. as a crossfade weight or a time remap
+		static EasingExpression time();
+
+		// The same value for every t
+		static EasingExpression constant(float value);
+
+		// first over [0, split), second over [split, 1]; each sees its own
+		// time scaled to [0, 1]. split must lie strictly inside (0, 1)
+		static EasingExpression sequence(const EasingExpression& first,
+										 const EasingExpression& second, float split = 0.5f);
+
+		// a + (b - a) * weight
+		static EasingExpression blend(const EasingExpression& a, const EasingExpression& b, float weight);
+		static EasingExpression blend(const EasingExpression& a, const EasingExpression& b,
+									  const EasingExpression& weight);
+
+		// this(1 - t): plays the curve backwards
+		EasingExpression reverse() const;
+
+		// this(2t) then this(2 - 2t): plays forwards and back again
+		EasingExpression mirror() const;
+
+		// offset + factor * this(t)
+		EasingExpression scale(float factor, float offset = 0.f) const;
+
+		// this(t) limited to [low, high]
+		EasingExpression clamp(float low = 0.f, float high = 1.f) const;
+
+		// Plays the whole curve between start and end, holding its end
+		// values outside; start must be below end
+		EasingExpression remap(float start, float end) const;
+
+		// this(time(t)): time is any expression, e.g. another curve
+		EasingExpression remap(const EasingExpression& time) const;
+
+		const Node& root() const;
+	};
+
+	/**
+	An EasingExpression flattened into a linear program.
+
+	Each op reads and writes whole registers of BLOCK_SIZE floats, so the
+	interpreter switches once per op per block rather than once per node
+	per value, and every op body is a tight loop the compiler vectorizes.
+	Curve leaves run through Interpolate::evaluate. Sequences evaluate
+	both sides and select per lane instead of branching, and all time
+	transforms (reverse, scale, clamp, remap) collapse into one affine op
+	with a clamp.
+
+	A compiled curve is immutable and may be shared between threads;
+	each thread evaluates through its own scratch registers.
+	*/
+
+	class CompiledEasing {
+	public:
+		enum class OpCode : std::uint8_t {
+			Ease,		// dst = func(a)
+			Constant,	// dst = p0
+			Affine,		// dst = clamp(p0 * a + p1, p2, p3)
+			Mirror,		// dst = 1 - |1 - 2a|
+			Lerp,		// dst = a + (b - a) * c
+			Select		// dst = a < p0 ? b : c
+		};
+
+		struct Op {
+			OpCode code;
+			InterpFunc func;
+			std::uint16_t dst;
+			std::uint16_t a;
+			std::uint16_t b;
+			std::uint16_t c;
+			float p[4];
+		};
+
+	private:
+		std::vector<Op> m_ops;
+		std::uint16_t m_registers;
+		std::uint16_t m_result;
+
+		std::uint16_t emit(const EasingExpression::Node& node, std::uint16_t time);
+		std::uint16_t push(Op op);
+
+		void run(const float* t, float* out, std::size_t count, float* scratch) const;
+
+	public:
+		static const std::size_t BLOCK_SIZE;
+
+		explicit CompiledEasing(const EasingExpression& expression);
+
+		float apply(float t) const;
+		float apply(float t, float b, float c, float d) const;
+
+		// out[i] = curve(t[i]) for count normalized times
+		void evaluate(const float* t, float* out, std::size_t count) const;
+
+		const std::vector<Op>& ops() const;
+		std::size_t registerCount() const;
+	};
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef EasingInverse_Hpp
+#define EasingInverse_Hpp
+
+#include <cstddef>
+#include <vector>
+#include "engine/interp_func.hpp"
+
+namespace animation {
+
+	/**
+	Maps an eased value back to the normalized time that produces it,
+	i.e. solves ease(t) = value for t in [0, 1].
+
+	Polynomial, sine, expo and circular curves are monotonic and use a
+	closed form; values outside [0, 1] are clamped. Back, elastic and
+	bounce curves reach some values more than once, so they are solved
+	numerically for the earliest t: a coarse scan brackets the first
+	crossing, then Newton steps with the analytical velocity refine it,
+	falling back to bisection whenever a step leaves the bracket. Peaks
+	narrower than the scan are found where the velocity changes sign.
+	When a value is never reached, the time of the closest approach is
+	returned.
+	*/
+
+	class EasingInverse {
+	public:
+		EasingInverse() = delete;
+		EasingInverse(const EasingInverse&) = delete;
+		EasingInverse& operator= (const EasingInverse&) = delete;
+
+		static const int   MAX_ITERATIONS;	// Newton/bisection steps per solve
+		static const int   SCAN_STEPS;		// intervals used to find the first crossing
+		static const float TOLERANCE;		// |ease(t) - value| accepted by the solver
+
+		static bool hasClosedForm(InterpFunc func);
+
+		// Earliest normalized t with ease(t) == value
+		static float solve(InterpFunc func, float value);
+
+		// Elapsed time in [0, d] for the (t, b, c, d) form
+		static float solve(InterpFunc func, float value, float b, float c, float d);
+
+		// Numeric solve restricted to [lo, hi]; returns the end closest to
+		// value when the bracket holds no crossing
+		static float solve(InterpFunc func, float value, float lo, float hi);
+	};
+
+	/**
+	Cached inverse of one curve for repeated solves.
+
+	Stores resolution + 1 samples of the curve together with the running
+	minimum and maximum up to each sample. The earliest crossing of any
+	value is the first sample whose running range contains it, so every
+	solve is a binary search followed by a few bracketed Newton steps
+	(usually one or two) inside a single sample interval, regardless of
+	the curve. A table is immutable once built and can be shared between
+	tweens.
+
+	Values beyond a peak's highest sample, or inside the jump where the
+	expo and elastic curves snap to 0 and 1, resolve to the nearest
+	sampled crossing. At the default resolution ease(solve(v)) stays
+	within 1e-3 of v for every curve.
+	*/
+
+	class InverseTable {
+	private:
+		struct Sample {
+			float value;
+			float low;		// smallest value over samples [0, i]
+			float high;		// largest value over samples [0, i]
+		};
+
+		std::vector<Sample> m_samples;
+		InterpFunc m_function;
+		float m_scale;
+
+	public:
+		static const std::size_t DEFAULT_RESOLUTION;
+		static const int REFINE_ITERATIONS;	// upper bound on Newton steps per solve
+
+		explicit InverseTable(InterpFunc func, std::size_t resolution = DEFAULT_RESOLUTION);
+
+		InterpFunc function() const;
+		std::size_t resolution() const;
+
+		// Earliest normalized t with ease(t) == value
+		float solve(float value) const;
+	};
+}
+
+#endif
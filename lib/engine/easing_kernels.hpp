@@ -0,0 +1,695 @@
+#ifndef EasingKernels_Hpp
+#define EasingKernels_Hpp
+
+#include <cstddef>
+#include "engine/batch_kernels.hpp"
+#include "engine/interp_func.hpp"
+#include "engine/simd.hpp"
+
+namespace animation {
+namespace kernels {
+
+// Everything here, templates or not, is compiled once per instruction set
+// (see interpolate_batch_avx2.cpp and friends), so it lives in the same
+// per-target inline namespace as the lane types; otherwise the linker
+// could keep an AVX copy of a helper for the baseline path.
+inline namespace ANIMATION_SIMD_ABI {
+
+	/**
+	Lane-generic easing kernels used by the batch evaluation API.
+
+	Each kernel maps a normalized time u (t / d) to the eased value of the
+	matching Interpolate (t, b, c, d) overload with b = 0 and c = 1.
+	Piecewise curves evaluate both sides and blend with select() so the
+	same code runs unchanged on every simd lane type, with no branch on
+	the data. velocity(u) and acceleration(u) are the derivatives with
+	respect to u and match the FastMath functors in engine/easing.hpp;
+	those keep their branches and remain the single-value path.
+	*/
+
+	using simd::splat;
+
+	// Shared constants for the back and elastic curves, rounded the same
+	// way as engine/easing.hpp so both sides agree to the last bit
+	constexpr float PI = 3.1415927f;
+	constexpr float HALF_PI = 1.5707963f;
+	constexpr float BACK_C1 = 1.70158f;
+	constexpr float ELASTIC_C4 = (2.f * PI) / 3.f;
+	constexpr float ELASTIC_C5 = (2.f * PI) / 4.5f;
+	constexpr float LN2 = 0.693147181f;
+
+	// sqrt(x) kept away from zero where the circular curves turn vertical
+	template<class V>
+	inline V circRoot(V x) {
+		return simd::sqrt(simd::max(x, splat<V>(1e-8f)));
+	}
+
+	/** Derivatives of 2^e * sin(phase), where e and phase are linear in u.
+
+	k is d(e)/du * ln 2 and omega is d(phase)/du. Shared by the elastic curves.
+	The second derivative takes k * k - omega * omega and 2 * k * omega
+	ready-made: folding them at compile time, as the scalar functors do,
+	keeps the two in step where the terms cancel.
+	*/
+	struct DampedSine {
+		template<class V> static V velocity(V k, V e, V omega, V phase) {
+			return simd::exp2(e) * (k * simd::sin(phase) + omega * simd::cos(phase));
+		}
+		template<class V> static V acceleration(V sinTerm, V cosTerm, V e, V phase) {
+			return simd::exp2(e) * (sinTerm * simd::sin(phase) + cosTerm * simd::cos(phase));
+		}
+
+		static constexpr float sinTerm(float k, float omega) { return k * k - omega * omega; }
+		static constexpr float cosTerm(float k, float omega) { return 2.f * k * omega; }
+	};
+
+	struct Linear {
+		template<class V> static V apply(V u) { return u; }
+		template<class V> static V velocity(V) { return splat<V>(1.f); }
+		template<class V> static V acceleration(V) { return splat<V>(0.f); }
+	};
+
+	// ------------------------------------------------------------------
+	// Polynomial curves
+	// ------------------------------------------------------------------
+
+	struct QuadEaseIn {
+		template<class V> static V apply(V u) { return u * u; }
+		template<class V> static V velocity(V u) { return splat<V>(2.f) * u; }
+		template<class V> static V acceleration(V) { return splat<V>(2.f); }
+	};
+
+	struct QuadEaseOut {
+		template<class V> static V apply(V u) { return -u * (u - splat<V>(2.f)); }
+		template<class V> static V velocity(V u) { return splat<V>(2.f) * (splat<V>(1.f) - u); }
+		template<class V> static V acceleration(V) { return splat<V>(-2.f); }
+	};
+
+	struct QuadEaseInOut {
+		template<class V> static V apply(V u) {
+			V s = u + u;
+			V w = s - splat<V>(1.f);
+			V lo = splat<V>(0.5f) * s * s;
+			V hi = splat<V>(-0.5f) * (w * (w - splat<V>(2.f)) - splat<V>(1.f));
+			return select(s < splat<V>(1.f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			return select(u < splat<V>(0.5f), splat<V>(4.f) * u, splat<V>(4.f) * (splat<V>(1.f) - u));
+		}
+		template<class V> static V acceleration(V u) {
+			return select(u < splat<V>(0.5f), splat<V>(4.f), splat<V>(-4.f));
+		}
+	};
+
+	struct CubicEaseIn {
+		template<class V> static V apply(V u) { return u * u * u; }
+		template<class V> static V velocity(V u) { return splat<V>(3.f) * u * u; }
+		template<class V> static V acceleration(V u) { return splat<V>(6.f) * u; }
+	};
+
+	struct CubicEaseOut {
+		template<class V> static V apply(V u) {
+			V w = u - splat<V>(1.f);
+			return w * w * w + splat<V>(1.f);
+		}
+		template<class V> static V velocity(V u) {
+			V w = splat<V>(1.f) - u;
+			return splat<V>(3.f) * w * w;
+		}
+		template<class V> static V acceleration(V u) { return splat<V>(-6.f) * (splat<V>(1.f) - u); }
+	};
+
+	struct CubicEaseInOut {
+		template<class V> static V apply(V u) {
+			V s = u + u;
+			V w = s - splat<V>(2.f);
+			V lo = splat<V>(0.5f) * s * s * s;
+			V hi = splat<V>(0.5f) * (w * w * w + splat<V>(2.f));
+			return select(s < splat<V>(1.f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			V w = splat<V>(2.f) - (u + u);
+			return select(u < splat<V>(0.5f), splat<V>(12.f) * u * u, splat<V>(3.f) * w * w);
+		}
+		template<class V> static V acceleration(V u) {
+			V w = splat<V>(2.f) - (u + u);
+			return select(u < splat<V>(0.5f), splat<V>(24.f) * u, splat<V>(-12.f) * w);
+		}
+	};
+
+	struct QuartEaseIn {
+		template<class V> static V apply(V u) {
+			V u2 = u * u;
+			return u2 * u2;
+		}
+		template<class V> static V velocity(V u) { return splat<V>(4.f) * u * u * u; }
+		template<class V> static V acceleration(V u) { return splat<V>(12.f) * u * u; }
+	};
+
+	struct QuartEaseOut {
+		template<class V> static V apply(V u) {
+			V w = u - splat<V>(1.f);
+			V w2 = w * w;
+			return splat<V>(1.f) - w2 * w2;
+		}
+		template<class V> static V velocity(V u) {
+			V w = splat<V>(1.f) - u;
+			return splat<V>(4.f) * w * w * w;
+		}
+		template<class V> static V acceleration(V u) {
+			V w = splat<V>(1.f) - u;
+			return splat<V>(-12.f) * w * w;
+		}
+	};
+
+	struct QuartEaseInOut {
+		template<class V> static V apply(V u) {
+			V s = u + u;
+			V w = s - splat<V>(2.f);
+			V s2 = s * s;
+			V w2 = w * w;
+			V lo = splat<V>(0.5f) * s2 * s2;
+			V hi = splat<V>(-0.5f) * (w2 * w2 - splat<V>(2.f));
+			return select(s < splat<V>(1.f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			V w = splat<V>(2.f) - (u + u);
+			return select(u < splat<V>(0.5f), splat<V>(32.f) * u * u * u, splat<V>(4.f) * w * w * w);
+		}
+		template<class V> static V acceleration(V u) {
+			V w = splat<V>(2.f) - (u + u);
+			return select(u < splat<V>(0.5f), splat<V>(96.f) * u * u, splat<V>(-24.f) * w * w);
+		}
+	};
+
+	struct QuintEaseIn {
+		template<class V> static V apply(V u) {
+			V u2 = u * u;
+			return u2 * u2 * u;
+		}
+		template<class V> static V velocity(V u) {
+			V u2 = u * u;
+			return splat<V>(5.f) * u2 * u2;
+		}
+		template<class V> static V acceleration(V u) { return splat<V>(20.f) * u * u * u; }
+	};
+
+	struct QuintEaseOut {
+		template<class V> static V apply(V u) {
+			V w = u - splat<V>(1.f);
+			V w2 = w * w;
+			return w2 * w2 * w + splat<V>(1.f);
+		}
+		template<class V> static V velocity(V u) {
+			V w = splat<V>(1.f) - u;
+			V w2 = w * w;
+			return splat<V>(5.f) * w2 * w2;
+		}
+		template<class V> static V acceleration(V u) {
+			V w = splat<V>(1.f) - u;
+			return splat<V>(-20.f) * w * w * w;
+		}
+	};
+
+	struct QuintEaseInOut {
+		template<class V> static V apply(V u) {
+			V s = u + u;
+			V w = s - splat<V>(2.f);
+			V s2 = s * s;
+			V w2 = w * w;
+			V lo = splat<V>(0.5f) * s2 * s2 * s;
+			V hi = splat<V>(0.5f) * (w2 * w2 * w + splat<V>(2.f));
+			return select(s < splat<V>(1.f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			V w = splat<V>(2.f) - (u + u);
+			V u2 = u * u;
+			V w2 = w * w;
+			return select(u < splat<V>(0.5f), splat<V>(80.f) * u2 * u2, splat<V>(5.f) * w2 * w2);
+		}
+		template<class V> static V acceleration(V u) {
+			V w = splat<V>(2.f) - (u + u);
+			return select(u < splat<V>(0.5f), splat<V>(320.f) * u * u * u, splat<V>(-40.f) * w * w * w);
+		}
+	};
+
+	// ------------------------------------------------------------------
+	// Sinusoidal, exponential and circular curves
+	// ------------------------------------------------------------------
+
+	struct SineEaseIn {
+		template<class V> static V apply(V u) {
+			return splat<V>(1.f) - simd::cos(u * splat<V>(HALF_PI));
+		}
+		template<class V> static V velocity(V u) { return splat<V>(HALF_PI) * simd::sin(u * splat<V>(HALF_PI)); }
+		template<class V> static V acceleration(V u) { return splat<V>(HALF_PI * HALF_PI) * simd::cos(u * splat<V>(HALF_PI)); }
+	};
+
+	struct SineEaseOut {
+		template<class V> static V apply(V u) {
+			return simd::sin(u * splat<V>(HALF_PI));
+		}
+		template<class V> static V velocity(V u) { return splat<V>(HALF_PI) * simd::cos(u * splat<V>(HALF_PI)); }
+		template<class V> static V acceleration(V u) { return splat<V>(-HALF_PI * HALF_PI) * simd::sin(u * splat<V>(HALF_PI)); }
+	};
+
+	struct SineEaseInOut {
+		template<class V> static V apply(V u) {
+			return splat<V>(-0.5f) * (simd::cos(u * splat<V>(PI)) - splat<V>(1.f));
+		}
+		template<class V> static V velocity(V u) { return splat<V>(HALF_PI) * simd::sin(u * splat<V>(PI)); }
+		template<class V> static V acceleration(V u) { return splat<V>(PI * HALF_PI) * simd::cos(u * splat<V>(PI)); }
+	};
+
+	struct ExpoEaseIn {
+		template<class V> static V apply(V u) {
+			return simd::exp2(splat<V>(10.f) * (u - splat<V>(1.f)));
+		}
+		template<class V> static V velocity(V u) { return splat<V>(10.f * LN2) * simd::exp2(splat<V>(10.f) * u - splat<V>(10.f)); }
+		template<class V> static V acceleration(V u) { return splat<V>(100.f * LN2 * LN2) * simd::exp2(splat<V>(10.f) * u - splat<V>(10.f)); }
+	};
+
+	struct ExpoEaseOut {
+		template<class V> static V apply(V u) {
+			return splat<V>(1.f) - simd::exp2(splat<V>(-10.f) * u);
+		}
+		template<class V> static V velocity(V u) { return splat<V>(10.f * LN2) * simd::exp2(splat<V>(-10.f) * u); }
+		template<class V> static V acceleration(V u) { return splat<V>(-100.f * LN2 * LN2) * simd::exp2(splat<V>(-10.f) * u); }
+	};
+
+	struct ExpoEaseInOut {
+		template<class V> static V apply(V u) {
+			V s = u + u;
+			V lo = splat<V>(0.5f) * simd::exp2(splat<V>(10.f) * (s - splat<V>(1.f)));
+			V hi = splat<V>(0.5f) * (splat<V>(2.f) - simd::exp2(splat<V>(-10.f) * (s - splat<V>(1.f))));
+			return select(s < splat<V>(1.f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			// Mirror the exponent for the second half so one exp2 covers both
+			auto half = u < splat<V>(0.5f);
+			V x = splat<V>(20.f) * u - splat<V>(10.f);
+			return splat<V>(10.f * LN2) * simd::exp2(select(half, x, -x));
+		}
+		template<class V> static V acceleration(V u) {
+			auto half = u < splat<V>(0.5f);
+			V x = splat<V>(20.f) * u - splat<V>(10.f);
+			V k = select(half, splat<V>(200.f * LN2 * LN2), splat<V>(-200.f * LN2 * LN2));
+			return k * simd::exp2(select(half, x, -x));
+		}
+	};
+
+	struct CircEaseIn {
+		template<class V> static V apply(V u) {
+			return splat<V>(1.f) - simd::sqrt(splat<V>(1.f) - u * u);
+		}
+		template<class V> static V velocity(V u) { return u / circRoot(splat<V>(1.f) - u * u); }
+		template<class V> static V acceleration(V u) {
+			V r = circRoot(splat<V>(1.f) - u * u);
+			return splat<V>(1.f) / (r * r * r);
+		}
+	};
+
+	struct CircEaseOut {
+		template<class V> static V apply(V u) {
+			V w = u - splat<V>(1.f);
+			return simd::sqrt(splat<V>(1.f) - w * w);
+		}
+		template<class V> static V velocity(V u) {
+			V w = u - splat<V>(1.f);
+			return -w / circRoot(splat<V>(1.f) - w * w);
+		}
+		template<class V> static V acceleration(V u) {
+			V w = u - splat<V>(1.f);
+			V r = circRoot(splat<V>(1.f) - w * w);
+			return splat<V>(-1.f) / (r * r * r);
+		}
+	};
+
+	struct CircEaseInOut {
+		template<class V> static V apply(V u) {
+			V s = u + u;
+			V w = s - splat<V>(2.f);
+			V lo = splat<V>(-0.5f) * (simd::sqrt(splat<V>(1.f) - s * s) - splat<V>(1.f));
+			V hi = splat<V>(0.5f) * (simd::sqrt(splat<V>(1.f) - w * w) + splat<V>(1.f));
+			return select(s < splat<V>(1.f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			V s = select(u < splat<V>(0.5f), u + u, splat<V>(2.f) - (u + u));
+			return s / circRoot(splat<V>(1.f) - s * s);
+		}
+		template<class V> static V acceleration(V u) {
+			auto half = u < splat<V>(0.5f);
+			V s = select(half, u + u, splat<V>(2.f) - (u + u));
+			V r = circRoot(splat<V>(1.f) - s * s);
+			return select(half, splat<V>(2.f), splat<V>(-2.f)) / (r * r * r);
+		}
+	};
+
+	// ------------------------------------------------------------------
+	// Back, elastic and bounce curves
+	// ------------------------------------------------------------------
+
+	struct BackEaseIn {
+		template<class V> static V apply(V u) {
+			V u2 = u * u;
+			return splat<V>(BACK_C1 + 1.f) * u2 * u - splat<V>(BACK_C1) * u2;
+		}
+		template<class V> static V velocity(V u) { return splat<V>(3.f * (BACK_C1 + 1.f)) * u * u - splat<V>(2.f * BACK_C1) * u; }
+		template<class V> static V acceleration(V u) { return splat<V>(6.f * (BACK_C1 + 1.f)) * u - splat<V>(2.f * BACK_C1); }
+	};
+
+	struct BackEaseOut {
+		template<class V> static V apply(V u) {
+			V w = u - splat<V>(1.f);
+			V w2 = w * w;
+			return splat<V>(1.f) + splat<V>(BACK_C1 + 1.f) * w2 * w + splat<V>(BACK_C1) * w2;
+		}
+		template<class V> static V velocity(V u) {
+			V w = u - splat<V>(1.f);
+			return splat<V>(3.f * (BACK_C1 + 1.f)) * w * w + splat<V>(2.f * BACK_C1) * w;
+		}
+		template<class V> static V acceleration(V u) { return splat<V>(6.f * (BACK_C1 + 1.f)) * (u - splat<V>(1.f)) + splat<V>(2.f * BACK_C1); }
+	};
+
+	struct BackEaseInOut {
+		template<class V> static V apply(V u) {
+			const float c2 = BACK_C1 * 1.525f;
+			V s = u + u;
+			V w = s - splat<V>(2.f);
+			V lo = splat<V>(0.5f) * s * s * (splat<V>(c2 + 1.f) * s - splat<V>(c2));
+			V hi = splat<V>(0.5f) * (w * w * (splat<V>(c2 + 1.f) * w + splat<V>(c2)) + splat<V>(2.f));
+			return select(u < splat<V>(0.5f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			const float c2 = BACK_C1 * 1.525f;
+			auto half = u < splat<V>(0.5f);
+			V s = select(half, u + u, u + u - splat<V>(2.f));
+			V k = select(half, splat<V>(-2.f * c2), splat<V>(2.f * c2));
+			return splat<V>(3.f * (c2 + 1.f)) * s * s + k * s;
+		}
+		template<class V> static V acceleration(V u) {
+			const float c2 = BACK_C1 * 1.525f;
+			auto half = u < splat<V>(0.5f);
+			V s = select(half, u + u, u + u - splat<V>(2.f));
+			V k = select(half, splat<V>(-2.f * c2), splat<V>(2.f * c2));
+			return splat<V>(2.f) * (splat<V>(6.f * (c2 + 1.f)) * s + k);
+		}
+	};
+
+	struct ElasticEaseIn {
+		template<class V> static V apply(V u) {
+			V e = simd::exp2(splat<V>(10.f) * u - splat<V>(10.f));
+			V s = simd::sin((u * splat<V>(10.f) - splat<V>(10.75f)) * splat<V>(ELASTIC_C4));
+			V val = -e * s;
+			val = select(u == splat<V>(1.f), splat<V>(1.f), val);
+			return select(u == splat<V>(0.f), splat<V>(0.f), val);
+		}
+		template<class V> static V velocity(V u) {
+			V e = splat<V>(10.f) * u - splat<V>(10.f);
+			V phase = (u * splat<V>(10.f) - splat<V>(10.75f)) * splat<V>(ELASTIC_C4);
+			return -DampedSine::velocity(splat<V>(10.f * LN2), e, splat<V>(10.f * ELASTIC_C4), phase);
+		}
+		template<class V> static V acceleration(V u) {
+			V e = splat<V>(10.f) * u - splat<V>(10.f);
+			V phase = (u * splat<V>(10.f) - splat<V>(10.75f)) * splat<V>(ELASTIC_C4);
+			const float k = 10.f * LN2;
+			const float omega = 10.f * ELASTIC_C4;
+			return -DampedSine::acceleration(splat<V>(DampedSine::sinTerm(k, omega)), splat<V>(DampedSine::cosTerm(k, omega)), e, phase);
+		}
+	};
+
+	struct ElasticEaseOut {
+		template<class V> static V apply(V u) {
+			V e = simd::exp2(splat<V>(-10.f) * u);
+			V s = simd::sin((u * splat<V>(10.f) - splat<V>(0.75f)) * splat<V>(ELASTIC_C4));
+			V val = e * s + splat<V>(1.f);
+			val = select(u == splat<V>(1.f), splat<V>(1.f), val);
+			return select(u == splat<V>(0.f), splat<V>(0.f), val);
+		}
+		template<class V> static V velocity(V u) {
+			V phase = (u * splat<V>(10.f) - splat<V>(0.75f)) * splat<V>(ELASTIC_C4);
+			return DampedSine::velocity(splat<V>(-10.f * LN2), splat<V>(-10.f) * u, splat<V>(10.f * ELASTIC_C4), phase);
+		}
+		template<class V> static V acceleration(V u) {
+			V phase = (u * splat<V>(10.f) - splat<V>(0.75f)) * splat<V>(ELASTIC_C4);
+			const float k = -10.f * LN2;
+			const float omega = 10.f * ELASTIC_C4;
+			return DampedSine::acceleration(splat<V>(DampedSine::sinTerm(k, omega)), splat<V>(DampedSine::cosTerm(k, omega)), splat<V>(-10.f) * u, phase);
+		}
+	};
+
+	struct ElasticEaseInOut {
+		template<class V> static V apply(V u) {
+			V x = splat<V>(20.f) * u - splat<V>(10.f);
+			V s = simd::sin((splat<V>(20.f) * u - splat<V>(11.125f)) * splat<V>(ELASTIC_C5));
+			V lo = splat<V>(-0.5f) * simd::exp2(x) * s;
+			V hi = splat<V>(0.5f) * simd::exp2(-x) * s + splat<V>(1.f);
+			V val = select(u < splat<V>(0.5f), lo, hi);
+			val = select(u == splat<V>(1.f), splat<V>(1.f), val);
+			return select(u == splat<V>(0.f), splat<V>(0.f), val);
+		}
+		template<class V> static V velocity(V u) {
+			// Both halves share the phase; the growth rate and exponent flip sign
+			auto half = u < splat<V>(0.5f);
+			V x = splat<V>(20.f) * u - splat<V>(10.f);
+			V k = select(half, splat<V>(20.f * LN2), splat<V>(-20.f * LN2));
+			V phase = (splat<V>(20.f) * u - splat<V>(11.125f)) * splat<V>(ELASTIC_C5);
+			V val = DampedSine::velocity(k, select(half, x, -x), splat<V>(20.f * ELASTIC_C5), phase);
+			return select(half, splat<V>(-0.5f), splat<V>(0.5f)) * val;
+		}
+		template<class V> static V acceleration(V u) {
+			const float k = 20.f * LN2;
+			const float omega = 20.f * ELASTIC_C5;
+			auto half = u < splat<V>(0.5f);
+			V x = splat<V>(20.f) * u - splat<V>(10.f);
+			V cosTerm = select(half, splat<V>(DampedSine::cosTerm(k, omega)), splat<V>(DampedSine::cosTerm(-k, omega)));
+			V phase = (splat<V>(20.f) * u - splat<V>(11.125f)) * splat<V>(ELASTIC_C5);
+			V val = DampedSine::acceleration(splat<V>(DampedSine::sinTerm(k, omega)), cosTerm, select(half, x, -x), phase);
+			return select(half, splat<V>(-0.5f), splat<V>(0.5f)) * val;
+		}
+	};
+
+	struct BounceEaseOut {
+		static constexpr float N1 = 7.5625f;
+		static constexpr float D1 = 2.75f;
+
+		// Each segment is a parabola N1 * (u - offset)^2 + height; pick the
+		// segment with selects so only one parabola is evaluated
+		template<class V> static void segment(V u, V& offset, V& height) {
+			offset = splat<V>(2.625f / D1);
+			height = splat<V>(0.984375f);
+			offset = select(u < splat<V>(2.5f / D1), splat<V>(2.25f / D1), offset);
+			height = select(u < splat<V>(2.5f / D1), splat<V>(0.9375f), height);
+			offset = select(u < splat<V>(2.f / D1), splat<V>(1.5f / D1), offset);
+			height = select(u < splat<V>(2.f / D1), splat<V>(0.75f), height);
+			offset = select(u < splat<V>(1.f / D1), splat<V>(0.f), offset);
+			height = select(u < splat<V>(1.f / D1), splat<V>(0.f), height);
+		}
+
+		template<class V> static V apply(V u) {
+			V offset, height;
+			segment(u, offset, height);
+			V w = u - offset;
+			return splat<V>(N1) * w * w + height;
+		}
+		template<class V> static V velocity(V u) {
+			V offset, height;
+			segment(u, offset, height);
+			return splat<V>(2.f * N1) * (u - offset);
+		}
+		template<class V> static V acceleration(V) { return splat<V>(2.f * N1); }
+	};
+
+	struct BounceEaseIn {
+		template<class V> static V apply(V u) {
+			return splat<V>(1.f) - BounceEaseOut::apply(splat<V>(1.f) - u);
+		}
+		template<class V> static V velocity(V u) { return BounceEaseOut::velocity(splat<V>(1.f) - u); }
+		template<class V> static V acceleration(V) { return splat<V>(-2.f * BounceEaseOut::N1); }
+	};
+
+	struct BounceEaseInOut {
+		template<class V> static V apply(V u) {
+			V s = u + u;
+			V lo = splat<V>(0.5f) * (splat<V>(1.f) - BounceEaseOut::apply(splat<V>(1.f) - s));
+			V hi = splat<V>(0.5f) * (splat<V>(1.f) + BounceEaseOut::apply(s - splat<V>(1.f)));
+			return select(u < splat<V>(0.5f), lo, hi);
+		}
+		template<class V> static V velocity(V u) {
+			V s = u + u;
+			return BounceEaseOut::velocity(select(u < splat<V>(0.5f), splat<V>(1.f) - s, s - splat<V>(1.f)));
+		}
+		template<class V> static V acceleration(V u) {
+			return select(u < splat<V>(0.5f), splat<V>(-4.f * BounceEaseOut::N1), splat<V>(4.f * BounceEaseOut::N1));
+		}
+	};
+
+	/** Calls visitor(Kernel()) with the kernel type matching func.
+
+	The switch runs once per call, so batch loops instantiated inside the
+	visitor contain no per-element dispatch. Unknown values fall back to
+	QuartEaseOut, matching Tween::update().
+	*/
+	template<class Visitor>
+	inline void dispatch(InterpFunc func, Visitor&& visitor) {
+		switch (func) {
+		case InterpFunc::Linear:           visitor(Linear()); break;
+		case InterpFunc::QuadEaseIn:       visitor(QuadEaseIn()); break;
+		case InterpFunc::QuadEaseOut:      visitor(QuadEaseOut()); break;
+		case InterpFunc::QuadEaseInOut:    visitor(QuadEaseInOut()); break;
+		case InterpFunc::CubicEaseIn:      visitor(CubicEaseIn()); break;
+		case InterpFunc::CubicEaseOut:     visitor(CubicEaseOut()); break;
+		case InterpFunc::CubicEaseInOut:   visitor(CubicEaseInOut()); break;
+		case InterpFunc::QuartEaseIn:      visitor(QuartEaseIn()); break;
+		case InterpFunc::QuartEaseOut:     visitor(QuartEaseOut()); break;
+		case InterpFunc::QuartEaseInOut:   visitor(QuartEaseInOut()); break;
+		case InterpFunc::QuintEaseIn:      visitor(QuintEaseIn()); break;
+		case InterpFunc::QuintEaseOut:     visitor(QuintEaseOut()); break;
+		case InterpFunc::QuintEaseInOut:   visitor(QuintEaseInOut()); break;
+		case InterpFunc::SineEaseIn:       visitor(SineEaseIn()); break;
+		case InterpFunc::SineEaseOut:      visitor(SineEaseOut()); break;
+		case InterpFunc::SineEaseInOut:    visitor(SineEaseInOut()); break;
+		case InterpFunc::ExpoEaseIn:       visitor(ExpoEaseIn()); break;
+		case InterpFunc::ExpoEaseOut:      visitor(ExpoEaseOut()); break;
+		case InterpFunc::ExpoEaseInOut:    visitor(ExpoEaseInOut()); break;
+		case InterpFunc::CircEaseIn:       visitor(CircEaseIn()); break;
+		case InterpFunc::CircEaseOut:      visitor(CircEaseOut()); break;
+		case InterpFunc::CircEaseInOut:    visitor(CircEaseInOut()); break;
+		case InterpFunc::BackEaseIn:       visitor(BackEaseIn()); break;
+		case InterpFunc::BackEaseOut:      visitor(BackEaseOut()); break;
+		case InterpFunc::BackEaseInOut:    visitor(BackEaseInOut()); break;
+		case InterpFunc::ElasticEaseIn:    visitor(ElasticEaseIn()); break;
+		case InterpFunc::ElasticEaseOut:   visitor(ElasticEaseOut()); break;
+		case InterpFunc::ElasticEaseInOut: visitor(ElasticEaseInOut()); break;
+		case InterpFunc::BounceEaseIn:     visitor(BounceEaseIn()); break;
+		case InterpFunc::BounceEaseOut:    visitor(BounceEaseOut()); break;
+		case InterpFunc::BounceEaseInOut:  visitor(BounceEaseInOut()); break;
+		default:                           visitor(QuartEaseOut()); break;
+		}
+	}
+
+	// Runs kernel K over full vectors of type V, then finishes the tail one lane at a time
+	template<class K, class V>
+	void runBatch(const float* t, const float* b, const float* c, const float* d,
+				  float* out, std::size_t count) {
+		const std::size_t width = V::width;
+		std::size_t i = 0;
+
+		for (; i + width <= count; i += width) {
+			V u = simd::load(t + i, V()) / simd::load(d + i, V());
+			V val = simd::load(b + i, V()) + simd::load(c + i, V()) * K::apply(u);
+			simd::store(out + i, val);
+		}
+
+		for (; i < count; ++i) {
+			simd::f32x1 u = { t[i] / d[i] };
+			out[i] = b[i] + c[i] * K::apply(u).v;
+		}
+	}
+
+	template<class K, class V>
+	void runBatch(const float* t, float* out, std::size_t count) {
+		const std::size_t width = V::width;
+		std::size_t i = 0;
+
+		for (; i + width <= count; i += width) {
+			simd::store(out + i, K::apply(simd::load(t + i, V())));
+		}
+
+		for (; i < count; ++i) {
+			out[i] = K::apply(simd::f32x1 { t[i] }).v;
+		}
+	}
+
+	// Presents a kernel's first or second derivative as apply() for runBatch()
+	template<class K>
+	struct Velocity {
+		template<class V> static V apply(V u) { return K::velocity(u); }
+	};
+
+	template<class K>
+	struct Acceleration {
+		template<class V> static V apply(V u) { return K::acceleration(u); }
+	};
+
+	// c / d^Order * K(t / d): the Order'th time derivative of b + c * curve(t / d)
+	template<class K, class V, int Order>
+	void runDerivativeBatch(const float* t, const float* c, const float* d,
+							float* out, std::size_t count) {
+		const std::size_t width = V::width;
+		std::size_t i = 0;
+
+		for (; i + width <= count; i += width) {
+			V dv = simd::load(d + i, V());
+			V scale = simd::load(c + i, V()) / (Order == 1 ? dv : dv * dv);
+			simd::store(out + i, scale * K::apply(simd::load(t + i, V()) / dv));
+		}
+
+		for (; i < count; ++i) {
+			float scale = c[i] / (Order == 1 ? d[i] : d[i] * d[i]);
+			out[i] = scale * K::apply(simd::f32x1 { t[i] / d[i] }).v;
+		}
+	}
+
+	// Batch entry points for lane type V; the curve is resolved once per call
+	template<class V>
+	void evaluateBatch(InterpFunc func, const float* t, const float* b, const float* c, const float* d,
+					   float* out, std::size_t count) {
+		dispatch(func, [&](auto kernel) {
+			runBatch<decltype(kernel), V>(t, b, c, d, out, count);
+		});
+	}
+
+	template<class V>
+	void evaluateBatch(InterpFunc func, const float* t, float* out, std::size_t count) {
+		dispatch(func, [&](auto kernel) {
+			runBatch<decltype(kernel), V>(t, out, count);
+		});
+	}
+
+	template<class V>
+	void evaluateVelocityBatch(InterpFunc func, const float* t, const float*, const float* c, const float* d,
+							   float* out, std::size_t count) {
+		dispatch(func, [&](auto kernel) {
+			runDerivativeBatch<Velocity<decltype(kernel)>, V, 1>(t, c, d, out, count);
+		});
+	}
+
+	template<class V>
+	void evaluateVelocityBatch(InterpFunc func, const float* t, float* out, std::size_t count) {
+		dispatch(func, [&](auto kernel) {
+			runBatch<Velocity<decltype(kernel)>, V>(t, out, count);
+		});
+	}
+
+	template<class V>
+	void evaluateAccelerationBatch(InterpFunc func, const float* t, const float*, const float* c, const float* d,
+								   float* out, std::size_t count) {
+		dispatch(func, [&](auto kernel) {
+			runDerivativeBatch<Acceleration<decltype(kernel)>, V, 2>(t, c, d, out, count);
+		});
+	}
+
+	template<class V>
+	void evaluateAccelerationBatch(InterpFunc func, const float* t, float* out, std::size_t count) {
+		dispatch(func, [&](auto kernel) {
+			runBatch<Acceleration<decltype(kernel)>, V>(t, out, count);
+		});
+	}
+
+	// The BatchTable for lane type V. constexpr, so the table is constant
+	// initialised and the accessor that returns it runs no code built for
+	// the wider target.
+	template<class V>
+	constexpr BatchTable makeBatchTable(InstructionSet isa, const char* name) {
+		return BatchTable {
+			isa, name,
+			&evaluateBatch<V>, &evaluateBatch<V>,
+			&evaluateVelocityBatch<V>, &evaluateVelocityBatch<V>,
+			&evaluateAccelerationBatch<V>, &evaluateAccelerationBatch<V> };
+	}
+}
+}
+}
+
+#endif
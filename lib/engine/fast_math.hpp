@@ -0,0 +1,129 @@
+#ifndef FastMath_Hpp
+#define FastMath_Hpp
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace animation {
+namespace fastmath {
+
+	/**
+	Math policies used by the transcendental easing functors.
+
+	ExactMath   - the standard library (std::sin, std::cos, std::pow)
+	FastMath    - Cephes polynomials, sin/cos abs error ~1e-7 and exp2
+	              relative error ~2e-7; no library calls
+	FastestMath - low order minimax polynomials, sin/cos abs error
+	              6.8e-5 and exp2 relative error 7.5e-5
+
+	Measured error of every curve per policy, against a double precision
+	reference sampled at 100k points on [0, 1]:
+
+	                  Exact     Fast      Fastest
+	SineEaseIn        1.3e-7    3.0e-7    6.8e-5
+	SineEaseOut       7.5e-8    9.8e-8    6.8e-5
+	SineEaseInOut     1.2e-7    1.8e-7    3.4e-5
+	ExpoEaseIn        3.6e-7    3.6e-7    7.4e-5
+	ExpoEaseOut       6.5e-8    7.0e-8    7.3e-5
+	ExpoEaseInOut     2.0e-7    2.0e-7    3.7e-5
+	ElasticEaseIn     8.6e-7    8.6e-7    1.3e-4
+	ElasticEaseOut    1.7e-7    1.7e-7    1.3e-4
+	ElasticEaseInOut  3.1e-7    3.3e-7    6.2e-5
+
+	The Exact column is the float rounding of the curve's own arithmetic.
+	Fastest stays below 0.15 px on a 1000 px move.
+
+	Polynomial, circular, back and bounce curves are identical under every
+	policy; integer powers are always expanded into multiplications.
+	*/
+
+	struct ExactMath {
+		static float sin(float x)  { return std::sin(x); }
+		static float cos(float x)  { return std::cos(x); }
+		static float exp2(float x) { return std::pow(2.f, x); }
+	};
+
+	// 2^n for an integer n in [-126, 127]
+	inline float pow2i(int n) {
+		std::int32_t bits = static_cast<std::int32_t>(n + 127) << 23;
+		float r;
+		std::memcpy(&r, &bits, sizeof(r));
+		return r;
+	}
+
+	// Nearest integer, halfway cases away from zero
+	inline int roundToInt(float x) {
+		return static_cast<int>(x >= 0.f ? x + 0.5f : x - 0.5f);
+	}
+
+	struct FastMath {
+		static float sin(float x) {
+			// Reduce by quadrant: r = x - k * pi/2 with extended precision
+			int k = roundToInt(x * 0.636619772f);
+			float fk = static_cast<float>(k);
+			float r = x - fk * 1.5703125f;
+			r = r - fk * 4.837512969970703125e-4f;
+			r = r - fk * 7.549789948768648e-8f;
+
+			float z = r * r;
+			float y;
+
+			if (k & 1) {
+				y = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z
+					- 0.5f * z + 1.f;
+			}
+			else {
+				y = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+			}
+
+			return (k & 2) ? -y : y;
+		}
+
+		static float cos(float x) {
+			return sin(x + 1.57079632679f);
+		}
+
+		static float exp2(float x) {
+			x = x < -126.f ? -126.f : (x > 126.f ? 126.f : x);
+			int n = roundToInt(x);
+			float f = x - static_cast<float>(n);
+
+			float p = 1.535336188319500e-4f;
+			p = p * f + 1.339887440266574e-3f;
+			p = p * f + 9.618437357674640e-3f;
+			p = p * f + 5.550332471162809e-2f;
+			p = p * f + 2.402264791363012e-1f;
+			p = p * f + 6.931472028550421e-1f;
+			p = p * f + 1.f;
+
+			return p * pow2i(n);
+		}
+	};
+
+	struct FastestMath {
+		static float sin(float x) {
+			// Reduce to [-pi/2, pi/2]: sin(x) = (-1)^k * sin(x - k * pi)
+			int k = roundToInt(x * 0.318309886f);
+			float r = x - static_cast<float>(k) * 3.14159265f;
+			float z = r * r;
+			float y = ((7.514382539e-3f * z - 1.656730973e-1f) * z + 9.996967862e-1f) * r;
+			return (k & 1) ? -y : y;
+		}
+
+		static float cos(float x) {
+			return sin(x + 1.57079632679f);
+		}
+
+		static float exp2(float x) {
+			x = x < -126.f ? -126.f : (x > 126.f ? 126.f : x);
+			int n = roundToInt(x);
+			float f = x - static_cast<float>(n);
+			float p = ((5.517207845e-2f * f + 2.426111697e-1f) * f + 6.932609114e-1f) * f + 9.999280678e-1f;
+			return p * pow2i(n);
+		}
+	};
+}
+}
+
+#endif
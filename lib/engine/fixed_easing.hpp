@@ -0,0 +1,513 @@
+#ifndef FixedEasing_Hpp
+#define FixedEasing_Hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "engine/interp_func.hpp"
+
+namespace animation {
+namespace fixedpoint {
+
+	/**
+	Deterministic Q16.16 easing backend for lockstep simulations.
+
+	Every curve is evaluated with integer arithmetic only: products are
+	widened to 64 bits and rounded half up, sine and 2^x come from lookup
+	tables with linear interpolation, and square roots use an integer
+	digit-by-digit method. The tables are built at compile time from
+	integer Taylor series, so no floating point or library call is
+	involved anywhere and results are bit-identical on every platform and
+	compiler. Right shifts of negative values are assumed arithmetic,
+	which holds for every supported compiler (and is required by C++20).
+
+	Normalized inputs are clamped to [0, ONE]. Results match the float
+	curves to within 1e-4 (a few units of the last place of Q16.16).
+	*/
+
+	typedef std::int32_t q16;
+
+	constexpr int FRACTION_BITS = 16;
+	constexpr q16 ONE  = 1 << FRACTION_BITS;
+	constexpr q16 HALF = ONE / 2;
+
+	// Conversions; only used at the boundary, never inside the curves
+	inline q16 fromFloat(float x) {
+		return static_cast<q16>(x >= 0.f ? x * ONE + 0.5f : x * ONE - 0.5f);
+	}
+
+	inline float toFloat(q16 x) {
+		return static_cast<float>(x) / static_cast<float>(ONE);
+	}
+
+	constexpr q16 fromInt(int x) {
+		return static_cast<q16>(x * ONE);
+	}
+
+	// Product rounded half up
+	constexpr q16 mul(q16 a, q16 b) {
+		return static_cast<q16>((static_cast<std::int64_t>(a) * b + (ONE / 2)) >> FRACTION_BITS);
+	}
+
+	// Quotient truncated toward zero; b must be non-zero
+	constexpr q16 div(q16 a, q16 b) {
+		return static_cast<q16>((static_cast<std::int64_t>(a) * ONE) / b);
+	}
+
+	// Square root of a non-negative value, truncated
+	constexpr q16 sqrt(q16 x) {
+		std::uint64_t n = static_cast<std::uint64_t>(x < 0 ? 0 : x) << FRACTION_BITS;
+		std::uint64_t root = 0;
+		std::uint64_t bit = std::uint64_t(1) << 62;
+
+		while (bit > n)
+			bit >>= 2;
+
+		while (bit != 0) {
+			if (n >= root + bit) {
+				n -= root + bit;
+				root = (root >> 1) + bit;
+			}
+			else {
+				root >>= 1;
+			}
+			bit >>= 2;
+		}
+
+		return static_cast<q16>(root);
+	}
+
+	namespace detail {
+
+		constexpr int SIN_BITS  = 10;	// table entries per turn, log2
+		constexpr int EXP2_BITS = 8;	// table entries per octave, log2
+
+		// pi and ln 2 in Q2.30
+		constexpr std::int64_t PI_Q30  = 3373259426LL;
+		constexpr std::int64_t LN2_Q30 = 744261118LL;
+
+		// sin(x) for x in [0, pi/2], Q2.30 in and out
+		constexpr std::int64_t sinTaylor(std::int64_t x) {
+			std::int64_t x2 = (x * x) >> 30;
+			std::int64_t term = x;
+			std::int64_t sum = x;
+
+			for (int k = 1; k <= 7; ++k) {
+				term = -((term * x2) >> 30) / ((2 * k) * (2 * k + 1));
+				sum += term;
+			}
+
+			return sum;
+		}
+
+		// e^x for x in [0, ln 2], Q2.30 in and out
+		constexpr std::int64_t expTaylor(std::int64_t x) {
+			std::int64_t term = std::int64_t(1) << 30;
+			std::int64_t sum = term;
+
+			for (int k = 1; k <= 12; ++k) {
+				term = ((term * x) >> 30) / k;
+				sum += term;
+			}
+
+			return sum;
+		}
+
+		// One full turn of sine, Q2.30, with a closing entry for interpolation
+		constexpr std::array<std::int32_t, (1 << SIN_BITS) + 1> makeSinTable() {
+			std::array<std::int32_t, (1 << SIN_BITS) + 1> table {};
+			constexpr int quarter = 1 << (SIN_BITS - 2);
+
+			for (int i = 0; i <= quarter; ++i) {
+				std::int64_t angle = PI_Q30 * i / (2 * quarter);
+				std::int32_t s = static_cast<std::int32_t>(sinTaylor(angle));
+
+				table[i] = s;
+				table[2 * quarter - i] = s;
+				table[2 * quarter + i] = -s;
+				table[4 * quarter - i] = -s;
+			}
+
+			return table;
+		}
+
+		// 2^(i / 256) for i in [0, 256], Q2.30
+		constexpr std::array<std::int64_t, (1 << EXP2_BITS) + 1> makeExp2Table() {
+			std::array<std::int64_t, (1 << EXP2_BITS) + 1> table {};
+
+			for (int i = 0; i <= (1 << EXP2_BITS); ++i)
+				table[i] = expTaylor(LN2_Q30 * i >> EXP2_BITS);
+
+			return table;
+		}
+
+		constexpr auto SIN_TABLE  = makeSinTable();
+		constexpr auto EXP2_TABLE = makeExp2Table();
+
+		// Drops the extra Q2.30 precision, rounding half up
+		constexpr q16 fromQ30(std::int64_t x, int shift) {
+			return shift <= 0
+				? static_cast<q16>(x << -shift)
+				: shift >= 62 ? 0 : static_cast<q16>((x + (std::int64_t(1) << (shift - 1))) >> shift);
+		}
+	}
+
+	// sin(2 pi x) for x measured in turns
+	constexpr q16 sinTurns(q16 x) {
+		constexpr int fracBits = FRACTION_BITS - detail::SIN_BITS;
+		std::uint32_t phase = static_cast<std::uint32_t>(x) & (ONE - 1);
+		std::uint32_t i = phase >> fracBits;
+		std::int64_t frac = phase & ((1u << fracBits) - 1);
+
+		std::int64_t a = detail::SIN_TABLE[i];
+		std::int64_t b = detail::SIN_TABLE[i + 1];
+		std::int64_t s = a + (((b - a) * frac) >> fracBits);
+
+		return detail::fromQ30(s, 30 - FRACTION_BITS);
+	}
+
+	constexpr q16 cosTurns(q16 x) {
+		return sinTurns(x + ONE / 4);
+	}
+
+	// 2^x; results below the Q16.16 resolution flush to zero, x must stay below 15
+	constexpr q16 exp2(q16 x) {
+		constexpr int fracBits = FRACTION_BITS - detail::EXP2_BITS;
+		int n = x >> FRACTION_BITS;
+		std::uint32_t f = static_cast<std::uint32_t>(x) & (ONE - 1);
+		std::uint32_t i = f >> fracBits;
+		std::int64_t frac = f & ((1u << fracBits) - 1);
+
+		std::int64_t a = detail::EXP2_TABLE[i];
+		std::int64_t b = detail::EXP2_TABLE[i + 1];
+		std::int64_t p = a + (((b - a) * frac) >> fracBits);
+
+		return detail::fromQ30(p, 30 - FRACTION_BITS - n);
+	}
+
+	constexpr q16 clamp01(q16 t) {
+		return t < 0 ? 0 : (t > ONE ? ONE : t);
+	}
+
+	// ------------------------------------------------------------------
+	// Curves; t is normalized Q16.16 in [0, ONE]
+	// ------------------------------------------------------------------
+
+	struct Linear {
+		static constexpr q16 apply(q16 t) { return t; }
+	};
+
+	struct QuadEaseIn {
+		static constexpr q16 apply(q16 t) { return mul(t, t); }
+	};
+
+	struct QuadEaseOut {
+		static constexpr q16 apply(q16 t) {
+			q16 w = ONE - t;
+			return ONE - mul(w, w);
+		}
+	};
+
+	struct QuadEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t < HALF) {
+				q16 s = 2 * t;
+				return mul(s, s) / 2;
+			}
+
+			q16 w = 2 * (ONE - t);
+			return ONE - mul(w, w) / 2;
+		}
+	};
+
+	struct CubicEaseIn {
+		static constexpr q16 apply(q16 t) { return mul(mul(t, t), t); }
+	};
+
+	struct CubicEaseOut {
+		static constexpr q16 apply(q16 t) {
+			q16 w = ONE - t;
+			return ONE - mul(mul(w, w), w);
+		}
+	};
+
+	struct CubicEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t < HALF) {
+				q16 s = 2 * t;
+				return mul(mul(s, s), s) / 2;
+			}
+
+			q16 w = 2 * (ONE - t);
+			return ONE - mul(mul(w, w), w) / 2;
+		}
+	};
+
+	struct QuartEaseIn {
+		static constexpr q16 apply(q16 t) {
+			q16 t2 = mul(t, t);
+			return mul(t2, t2);
+		}
+	};
+
+	struct QuartEaseOut {
+		static constexpr q16 apply(q16 t) {
+			q16 w2 = mul(ONE - t, ONE - t);
+			return ONE - mul(w2, w2);
+		}
+	};
+
+	struct QuartEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t < HALF) {
+				q16 s2 = mul(2 * t, 2 * t);
+				return mul(s2, s2) / 2;
+			}
+
+			q16 w = 2 * (ONE - t);
+			q16 w2 = mul(w, w);
+			return ONE - mul(w2, w2) / 2;
+		}
+	};
+
+	struct QuintEaseIn {
+		static constexpr q16 apply(q16 t) {
+			q16 t2 = mul(t, t);
+			return mul(mul(t2, t2), t);
+		}
+	};
+
+	struct QuintEaseOut {
+		static constexpr q16 apply(q16 t) {
+			q16 w = ONE - t;
+			q16 w2 = mul(w, w);
+			return ONE - mul(mul(w2, w2), w);
+		}
+	};
+
+	struct QuintEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t < HALF) {
+				q16 s2 = mul(2 * t, 2 * t);
+				return mul(mul(s2, s2), 2 * t) / 2;
+			}
+
+			q16 w = 2 * (ONE - t);
+			q16 w2 = mul(w, w);
+			return ONE - mul(mul(w2, w2), w) / 2;
+		}
+	};
+
+	// Angles are expressed in turns, so pi t / 2 becomes t / 4
+	struct SineEaseIn {
+		static constexpr q16 apply(q16 t) { return ONE - cosTurns(t / 4); }
+	};
+
+	struct SineEaseOut {
+		static constexpr q16 apply(q16 t) { return sinTurns(t / 4); }
+	};
+
+	struct SineEaseInOut {
+		static constexpr q16 apply(q16 t) { return (ONE - cosTurns(t / 2)) / 2; }
+	};
+
+	struct ExpoEaseIn {
+		static constexpr q16 apply(q16 t) {
+			return t == 0 ? 0 : exp2(10 * t - fromInt(10));
+		}
+	};
+
+	struct ExpoEaseOut {
+		static constexpr q16 apply(q16 t) {
+			return t == ONE ? ONE : ONE - exp2(-10 * t);
+		}
+	};
+
+	struct ExpoEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t == 0)   return 0;
+			if (t == ONE) return ONE;
+
+			return t < HALF
+				? exp2(20 * t - fromInt(10)) / 2
+				: (2 * ONE - exp2(fromInt(10) - 20 * t)) / 2;
+		}
+	};
+
+	struct CircEaseIn {
+		static constexpr q16 apply(q16 t) { return ONE - sqrt(ONE - mul(t, t)); }
+	};
+
+	struct CircEaseOut {
+		static constexpr q16 apply(q16 t) {
+			q16 w = t - ONE;
+			return sqrt(ONE - mul(w, w));
+		}
+	};
+
+	struct CircEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t < HALF)
+				return (ONE - sqrt(ONE - 4 * mul(t, t))) / 2;
+
+			q16 w = 2 * (ONE - t);
+			return (sqrt(ONE - mul(w, w)) + ONE) / 2;
+		}
+	};
+
+	// 1.70158 and 1.70158 * 1.525 in Q16.16
+	constexpr q16 BACK_C1 = 111515;
+	constexpr q16 BACK_C2 = 170060;
+	constexpr q16 BACK_C3 = BACK_C1 + ONE;
+
+	struct BackEaseIn {
+		static constexpr q16 apply(q16 t) {
+			q16 t2 = mul(t, t);
+			return mul(mul(BACK_C3, t2), t) - mul(BACK_C1, t2);
+		}
+	};
+
+	struct BackEaseOut {
+		static constexpr q16 apply(q16 t) {
+			q16 w = t - ONE;
+			q16 w2 = mul(w, w);
+			return ONE + mul(mul(BACK_C3, w2), w) + mul(BACK_C1, w2);
+		}
+	};
+
+	struct BackEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t < HALF) {
+				q16 s = 2 * t;
+				return mul(mul(s, s), mul(BACK_C2 + ONE, s) - BACK_C2) / 2;
+			}
+
+			q16 w = 2 * t - 2 * ONE;
+			return (mul(mul(w, w), mul(BACK_C2 + ONE, w) + BACK_C2) + 2 * ONE) / 2;
+		}
+	};
+
+	// The elastic periods 2 pi / 3 and 2 pi / 4.5 become divisions of the
+	// phase in turns; 10.75, 0.75 and 11.125 in Q16.16
+	struct ElasticEaseIn {
+		static constexpr q16 apply(q16 t) {
+			if (t == 0)   return 0;
+			if (t == ONE) return ONE;
+
+			return -mul(exp2(10 * t - fromInt(10)), sinTurns((10 * t - 704512) / 3));
+		}
+	};
+
+	struct ElasticEaseOut {
+		static constexpr q16 apply(q16 t) {
+			if (t == 0)   return 0;
+			if (t == ONE) return ONE;
+
+			return mul(exp2(-10 * t), sinTurns((10 * t - 49152) / 3)) + ONE;
+		}
+	};
+
+	struct ElasticEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			if (t == 0)   return 0;
+			if (t == ONE) return ONE;
+
+			q16 s = sinTurns((20 * t - 729088) * 2 / 9);
+
+			return t < HALF
+				? -mul(exp2(20 * t - fromInt(10)), s) / 2
+				: mul(exp2(fromInt(10) - 20 * t), s) / 2 + ONE;
+		}
+	};
+
+	struct BounceEaseOut {
+		static constexpr q16 apply(q16 t) {
+			// n1 = 7.5625, d1 = 2.75; the breakpoints k / d1 are k * 4 / 11
+			constexpr q16 n1 = 495616;
+
+			if (t < ONE * 4 / 11)
+				return mul(mul(n1, t), t);
+
+			if (t < ONE * 8 / 11) {
+				q16 u = t - ONE * 6 / 11;
+				return mul(mul(n1, u), u) + ONE * 3 / 4;
+			}
+
+			if (t < ONE * 10 / 11) {
+				q16 u = t - ONE * 9 / 11;
+				return mul(mul(n1, u), u) + ONE * 15 / 16;
+			}
+
+			q16 u = t - ONE * 21 / 22;
+			return mul(mul(n1, u), u) + ONE * 63 / 64;
+		}
+	};
+
+	struct BounceEaseIn {
+		static constexpr q16 apply(q16 t) { return ONE - BounceEaseOut::apply(ONE - t); }
+	};
+
+	struct BounceEaseInOut {
+		static constexpr q16 apply(q16 t) {
+			return t < HALF
+				? (ONE - BounceEaseOut::apply(ONE - 2 * t)) / 2
+				: (ONE + BounceEaseOut::apply(2 * t - ONE)) / 2;
+		}
+	};
+
+	/** Calls visitor(Functor()) with the fixed-point functor matching a
+	runtime InterpFunc. Unknown values fall back to QuartEaseOut.
+	*/
+	template<class Visitor>
+	inline void dispatch(InterpFunc func, Visitor&& visitor) {
+		switch (func) {
+		case InterpFunc::Linear:           visitor(Linear()); break;
+		case InterpFunc::QuadEaseIn:       visitor(QuadEaseIn()); break;
+		case InterpFunc::QuadEaseOut:      visitor(QuadEaseOut()); break;
+		case InterpFunc::QuadEaseInOut:    visitor(QuadEaseInOut()); break;
+		case InterpFunc::CubicEaseIn:      visitor(CubicEaseIn()); break;
+		case InterpFunc::CubicEaseOut:     visitor(CubicEaseOut()); break;
+		case InterpFunc::CubicEaseInOut:   visitor(CubicEaseInOut()); break;
+		case InterpFunc::QuartEaseIn:      visitor(QuartEaseIn()); break;
+		case InterpFunc::QuartEaseOut:     visitor(QuartEaseOut()); break;
+		case InterpFunc::QuartEaseInOut:   visitor(QuartEaseInOut()); break;
+		case InterpFunc::QuintEaseIn:      visitor(QuintEaseIn()); break;
+		case InterpFunc::QuintEaseOut:     visitor(QuintEaseOut()); break;
+		case InterpFunc::QuintEaseInOut:   visitor(QuintEaseInOut()); break;
+		case InterpFunc::SineEaseIn:       visitor(SineEaseIn()); break;
+		case InterpFunc::SineEaseOut:      visitor(SineEaseOut()); break;
+		case InterpFunc::SineEaseInOut:    visitor(SineEaseInOut()); break;
+		case InterpFunc::ExpoEaseIn:       visitor(ExpoEaseIn()); break;
+		case InterpFunc::ExpoEaseOut:      visitor(ExpoEaseOut()); break;
+		case InterpFunc::ExpoEaseInOut:    visitor(ExpoEaseInOut()); break;
+		case InterpFunc::CircEaseIn:       visitor(CircEaseIn()); break;
+		case InterpFunc::CircEaseOut:      visitor(CircEaseOut()); break;
+		case InterpFunc::CircEaseInOut:    visitor(CircEaseInOut()); break;
+		case InterpFunc::BackEaseIn:       visitor(BackEaseIn()); break;
+		case InterpFunc::BackEaseOut:      visitor(BackEaseOut()); break;
+		case InterpFunc::BackEaseInOut:    visitor(BackEaseInOut()); break;
+		case InterpFunc::ElasticEaseIn:    visitor(ElasticEaseIn()); break;
+		case InterpFunc::ElasticEaseOut:   visitor(ElasticEaseOut()); break;
+		case InterpFunc::ElasticEaseInOut: visitor(ElasticEaseInOut()); break;
+		case InterpFunc::BounceEaseIn:     visitor(BounceEaseIn()); break;
+		case InterpFunc::BounceEaseOut:    visitor(BounceEaseOut()); break;
+		case InterpFunc::BounceEaseInOut:  visitor(BounceEaseInOut()); break;
+		default:                           visitor(QuartEaseOut()); break;
+		}
+	}
+
+	// Normalized evaluation; t is clamped to [0, ONE]
+	q16 evaluate(InterpFunc func, q16 t);
+
+	// b + c * ease(t / d); t is clamped to [0, d], d must be positive
+	q16 evaluate(InterpFunc func, q16 t, q16 b, q16 c, q16 d);
+
+	// Batch forms; the curve is dispatched once per call
+	void evaluate(InterpFunc func, const q16* t, q16* out, std::size_t count);
+
+	void evaluate(InterpFunc func, const q16* t, const q16* b, const q16* c, q16 d,
+		q16* out, std::size_t count);
+}
+}
+
+#endif
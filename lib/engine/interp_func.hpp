@@ -0,0 +1,61 @@
+#ifndef InterpFunc_Hpp
+#define InterpFunc_Hpp
+
+// Identifies one of the easing functions implemented by animation::Interpolate.
+enum class InterpFunc {
+	Linear = 1,
+
+	QuadEaseIn = 2,
+	QuadEaseOut = 3,
+	QuadEaseInOut = 4,
+
+	CubicEaseIn = 5,
+	CubicEaseOut = 6,
+	CubicEaseInOut = 7,
+
+	QuartEaseIn = 8,
+	QuartEaseOut = 9,
+	QuartEaseInOut = 10,
+
+	QuintEaseIn = 11,
+	QuintEaseOut = 12,
+	QuintEaseInOut = 13,
+
+	SineEaseIn = 14,
+	SineEaseOut = 15,
+	SineEaseInOut = 16,
+
+	ExpoEaseIn = 17,
+	ExpoEaseOut = 18,
+	ExpoEaseInOut = 19,
+
+	CircEaseIn = 20,
+	CircEaseOut = 21,
+	CircEaseInOut = 22,
+
+	BackEaseIn = 23,
+	BackEaseOut = 24,
+	BackEaseInOut = 25,
+
+	ElasticEaseIn = 26,
+	ElasticEaseOut = 27,
+	ElasticEaseInOut = 28,
+
+	BounceEaseIn = 29,
+	BounceEaseOut = 30,
+	BounceEaseInOut = 31
+};
+
+// Math policy used by the sine, expo and elastic curves (see engine/fast_math.hpp).
+// Default defers to the global setting, e.g. Tween::setDefaultPrecision().
+enum class EasingPrecision {
+	Default = 0,
+	Exact = 1,
+	Fast = 2,
+	Fastest = 3
+};
+
+// Number of easing functions in InterpFunc (ids run from 1 to INTERP_FUNC_COUNT).
+constexpr int INTERP_FUNC_COUNT = 31;
+
+#endif
\ No newline at end of file
@@ -2,6 +2,9 @@
 #define Interpolate_Hpp
 
 #include <cmath>
+#include <cstddef>
+#include "engine/cpu_features.hpp"
+#include "engine/interp_func.hpp"
 
 namespace animation {
 
@@ -11,6 +14,10 @@ namespace animation {
 	https://easings.net/
 
 	Functions with a single float parameter accept a value between 0 and 1.
+
+	Each function is a thin wrapper over the header-only functors in
+	engine/easing.hpp; include that header directly to have the curve
+	inlined into the caller.
 	*/
 
 	class Interpolate {
@@ -59,7 +66,8 @@ namespace animation {
 
 		// quartic easing in/out - acceleration until halfway, then deceleration
 		static float easeInOutQuart(float t, float b, float c, float d);
-		static float easeInOutQuard(float t);
+		static float easeInOutQuart(float t);
+		static float easeInOutQuard(float t); // misspelt alias kept for existing callers
 
 		// quintic easing in - accelerating from zero velocity
 		static float easeInQuint(float t, float b, float c, float d);
@@ -67,7 +75,8 @@ namespace animation {
 
 		// quintic easing out - decelerating to zero velocity
 		static float easeOutQuint(float t, float b, float c, float d);
-		static float easeOutQuant(float t);
+		static float easeOutQuint(float t);
+		static float easeOutQuant(float t); // misspelt alias kept for existing callers
 
 		// quintic easing in/out - acceleration until halfway, then deceleration
 		static float easeInOutQuint(float t, float b, float c, float d);
@@ -143,6 +152,65 @@ namespace animation {
 
 		// ease in out bounce
 		static float easeInOutBounce(float t, float b, float c, float d);
+
+		/**
+		Analytical first (velocity) and second (acceleration) derivatives
+		of every curve with respect to time.
+
+		The normalized forms are per unit of t. The (t, b, c, d) forms are
+		in value units per second when t and d are in seconds; b does not
+		change the slope and is accepted to mirror the curve overloads.
+		*/
+
+		static float velocity(InterpFunc func, float t);
+		static float velocity(InterpFunc func, float t, float b, float c, float d);
+
+		static float acceleration(InterpFunc func, float t);
+		static float acceleration(InterpFunc func, float t, float b, float c, float d);
+
+		/**
+		Batch evaluation over contiguous arrays, vectorized with the widest
+		instruction set the CPU supports (AVX-512, AVX2, SSE2 or NEON). The
+		kernels are built for each target and one is picked on first use
+		from CpuFeatures; every build gives the same results within the
+		tolerance below. Piecewise curves blend both sides with masks
+		instead of branching, so lanes at different phases cost the same;
+		the scalar functions above keep their branches for single calls.
+
+		Results match the scalar (t, b, c, d) overloads to within
+		BATCH_TOLERANCE * (1 + |b| + |c|). The normalized form matches the
+		same overloads with b = 0, c = 1 and d = 1.
+		*/
+
+		// out[i] = func(t[i], b[i], c[i], d[i]) for count elements
+		static void evaluate(InterpFunc func,
+							 const float* t, const float* b, const float* c, const float* d,
+							 float* out, std::size_t count);
+
+		// out[i] = func(t[i]) for count normalized times
+		static void evaluate(InterpFunc func, const float* t, float* out, std::size_t count);
+
+		// Batch derivatives on the same kernels, matching the scalar
+		// fastmath::FastMath derivatives in engine/easing.hpp
+		static void evaluateVelocity(InterpFunc func,
+									 const float* t, const float* b, const float* c, const float* d,
+									 float* out, std::size_t count);
+		static void evaluateVelocity(InterpFunc func, const float* t, float* out, std::size_t count);
+
+		static void evaluateAcceleration(InterpFunc func,
+										 const float* t, const float* b, const float* c, const float* d,
+										 float* out, std::size_t count);
+		static void evaluateAcceleration(InterpFunc func, const float* t, float* out, std::size_t count);
+
+		// Instruction set used by the batch functions, e.g. "AVX2"
+		static const char* batchInstructionSet();
+		static InstructionSet batchInstructionSetId();
+
+		// Forces the batch kernels for isa; false (and no change) when they
+		// are not built for this target or the CPU lacks isa
+		static bool useInstructionSet(InstructionSet isa);
+
+		static const float BATCH_TOLERANCE;
 	};
 }
 
@@ -0,0 +1,99 @@
+#ifndef JobSystem_Hpp
+#define JobSystem_Hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace animation {
+
+	/**
+	Fixed set of worker threads that run parallelFor() loops with work
+	stealing.
+
+	parallelFor() cuts [0, count) into ranges of grain elements and deals
+	them round-robin onto one queue per thread. Every thread, the caller
+	included, takes ranges from the back of its own queue and, once that
+	is empty, steals from the front of the others, so threads that drew
+	cheap ranges help with the expensive ones. The call returns when every
+	range has run.
+
+	Which thread runs a range is not deterministic, so the body must only
+	write outputs that belong to its range; the result is then the same
+	for every thread count. After the queues have grown to the largest
+	loop, parallelFor() does no heap allocation.
+
+	One parallelFor() runs at a time: calling it from inside a body, or
+	from two threads at once, is not supported.
+	*/
+
+	class JobSystem {
+	private:
+		struct Range {
+			std::size_t begin;
+			std::size_t end;
+		};
+
+		// One per thread; aligned so neighbouring queue locks don't share a line
+		struct alignas(64) Queue {
+			std::mutex mutex;
+			std::vector<Range> ranges;
+			std::size_t head;	// next range to steal
+			std::size_t tail;	// one past the owner's next range
+		};
+
+		typedef void (*RangeFunction)(void* context, std::size_t begin, std::size_t end);
+
+		// Index 0 belongs to the thread calling parallelFor()
+		std::vector<std::unique_ptr<Queue>> m_queues;
+		std::vector<std::thread> m_workers;
+
+		// Current loop, published to the workers through the queue locks
+		RangeFunction m_function;
+		void* m_context;
+		std::atomic<std::size_t> m_pending;
+
+		std::mutex m_mutex;
+		std::condition_variable m_wake;
+		std::condition_variable m_done;
+		std::size_t m_generation;
+		bool m_stop;
+
+		void workerLoop(std::size_t index);
+
+		// Runs ranges from queue index, then stolen ones, until none are left
+		void work(std::size_t index);
+		bool take(std::size_t index, Range& range);
+
+		void run(std::size_t count, std::size_t grain, RangeFunction function, void* context);
+
+	public:
+		// threadCount includes the caller, so 1 runs everything inline;
+		// 0 uses one thread per hardware thread
+		explicit JobSystem(std::size_t threadCount=0);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator= (const JobSystem&) = delete;
+
+		std::size_t threadCount() const;
+
+		// Calls body(begin, end) for consecutive ranges of at most grain
+		// indices covering [0, count), spread over the threads
+		template<class F>
+		void parallelFor(std::size_t count, std::size_t grain, F&& body) {
+			typedef typename std::remove_reference<F>::type Body;
+
+			run(count, grain, [](void* context, std::size_t begin, std::size_t end) {
+				(*static_cast<Body*>(context))(begin, end);
+			}, const_cast<void*>(static_cast<const void*>(&body)));
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef KeyframeCurve_Hpp
+#define KeyframeCurve_Hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/interp_func.hpp"
+
+namespace animation {
+
+	/** Playback position within a KeyframeCurve.
+
+	Each playing animation keeps its own cursor so one curve can be shared.
+	*/
+	struct KeyframeCursor {
+		std::size_t segment = 0;
+	};
+
+	/**
+	Piecewise curve through any number of keyframes, each segment eased by
+	its own InterpFunc.
+
+	Keys are stored as parallel arrays (times, values, function ids), so a
+	search only streams through the times. evaluate() with a cursor checks
+	the cached segment first and steps forward at most two keys from it,
+	which is O(1) for forward playback however many keys there are. Seeks
+	that jump further forward, backwards or without a cursor use a
+	branch-free binary search (conditional moves instead of unpredictable
+	branches), O(log n).
+
+	Before the first key the curve holds the first value and after the
+	last key it holds the last value.
+	*/
+
+	class KeyframeCurve {
+	private:
+		std::vector<float> m_times;
+		std::vector<float> m_values;
+		std::vector<std::uint8_t> m_functions;	// easing from key i to key i + 1
+
+		std::size_t findSegment(float time) const;
+		float evaluateSegment(std::size_t segment, float time) const;
+
+	public:
+		KeyframeCurve() = default;
+
+		/** Appends a key. Times must not decrease; function eases the
+		segment that starts at this key.
+		*/
+		void addKey(float time, float value, InterpFunc function = InterpFunc::Linear);
+
+		void clear();
+		void reserve(std::size_t keys);
+
+		std::size_t keyCount() const;
+		float startTime() const;
+		float endTime() const;
+
+		float time(std::size_t key) const;
+		float value(std::size_t key) const;
+		InterpFunc function(std::size_t key) const;
+
+		// Random access evaluation
+		float evaluate(float time) const;
+
+		// Evaluation through a playback cursor, which is updated
+		float evaluate(float time, KeyframeCursor& cursor) const;
+
+		// out[i] = evaluate(times[i], cursor) for count sample times
+		void evaluate(const float* times, float* out, std::size_t count, KeyframeCursor& cursor) const;
+	};
+}
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef LerpTraits_Hpp
+#define LerpTraits_Hpp
+
+#include <SFML/Graphics.hpp>
+#include "engine/easing.hpp"
+
+namespace animation {
+
+	/**
+	How a value type blends between two values for an easing weight w.
+
+	The primary template works for any type with a + (b - a) * w, which
+	covers float, sf::Vector2f and sf::Vector3f. The weight is not clamped:
+	back and elastic curves overshoot past 0 and 1 and every trait
+	extrapolates with them, except colour channels, which saturate.
+	*/
+	template<class T>
+	struct LerpTraits {
+		static T lerp(const T& a, const T& b, float w) {
+			return a + (b - a) * w;
+		}
+	};
+
+	namespace detail {
+
+		inline sf::Uint8 toChannel(float x) {
+			x = x < 0.f ? 0.f : (x > 255.f ? 255.f : x);
+			return static_cast<sf::Uint8>(x + 0.5f);
+		}
+
+		inline sf::Uint8 lerpChannel(sf::Uint8 a, sf::Uint8 b, float w) {
+			float fa = static_cast<float>(a);
+			return toChannel(fa + (static_cast<float>(b) - fa) * w);
+		}
+	}
+
+	// Straight alpha: every channel, alpha included, blends independently
+	template<>
+	struct LerpTraits<sf::Color> {
+		static sf::Color lerp(const sf::Color& a, const sf::Color& b, float w) {
+			return sf::Color(detail::lerpChannel(a.r, b.r, w),
+							 detail::lerpChannel(a.g, b.g, w),
+							 detail::lerpChannel(a.b, b.b, w),
+							 detail::lerpChannel(a.a, b.a, w));
+		}
+	};
+
+	/**
+	Colour blend in premultiplied alpha.
+
+	Fading to or from a transparent colour with straight alpha drags the
+	visible colour through the transparent one's RGB (usually black);
+	premultiplying first weights each colour by its own opacity.
+	*/
+	struct PremultipliedColorLerp {
+		static sf::Color lerp(const sf::Color& a, const sf::Color& b, float w) {
+			const float inv255 = 1.f / 255.f;
+			float aa = a.a * inv255;
+			float ba = b.a * inv255;
+			float alpha = aa + (ba - aa) * w;
+
+			if (alpha <= 0.f)
+				return sf::Color(0, 0, 0, 0);
+
+			auto channel = [&](sf::Uint8 ca, sf::Uint8 cb) {
+				float pa = ca * aa;
+				float pb = cb * ba;
+				return detail::toChannel((pa + (pb - pa) * w) / alpha);
+			};
+
+			return sf::Color(channel(a.r, b.r), channel(a.g, b.g), channel(a.b, b.b),
+							 detail::toChannel(alpha * 255.f));
+		}
+	};
+
+	/**
+	Element-wise blend of the 3x3 affine matrices.
+
+	Exact for translation and scale. Rotations are blended as matrices, so
+	large angles shrink through the middle of the tween; animate the angle
+	itself when that matters.
+	*/
+	template<>
+	struct LerpTraits<sf::Transform> {
+		static sf::Transform lerp(const sf::Transform& a, const sf::Transform& b, float w) {
+			// 4x4 column-major indices of the 3x3 matrix, row by row
+			const int index[9] = { 0, 4, 12, 1, 5, 13, 3, 7, 15 };
+			const float* ma = a.getMatrix();
+			const float* mb = b.getMatrix();
+			float m[9];
+
+			for (int i = 0; i < 9; ++i)
+				m[i] = ma[index[i]] + (mb[index[i]] - ma[index[i]]) * w;
+
+			return sf::Transform(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]);
+		}
+	};
+
+	/** Eases any value type from one value to another.
+
+	The curve is evaluated once and the weight applied to every component.
+	*/
+	template<class T, class Traits = LerpTraits<T>>
+	inline T interpolate(InterpFunc func, const T& from, const T& to, float t) {
+		return Traits::lerp(from, to, easing::evaluate(func, t));
+	}
+}
+
+#endif
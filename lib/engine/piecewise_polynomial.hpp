@@ -0,0 +1,74 @@
+#ifndef PiecewisePolynomial_Hpp
+#define PiecewisePolynomial_Hpp
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "engine/interp_func.hpp"
+
+namespace animation {
+
+	class CompiledEasing;
+
+	/**
+	Piecewise polynomial approximation of any easing curve on [0, 1].
+
+	The fitter interpolates the curve at Chebyshev-Lobatto nodes on an
+	interval and measures the error at CHECK_POINTS samples; intervals
+	over the tolerance are halved until they fit or reach
+	MIN_SEGMENT_WIDTH. Segments therefore concentrate where the curve is
+	hard to follow, such as the kinks of the bounce curves, and every
+	segment shares its end values with its neighbours.
+
+	Fitting is meant for load time. Evaluation is the same for every
+	curve: a branch-free binary search over the breakpoints and a Horner
+	evaluation of a quartic (cubic fits store a zero leading term).
+
+	The fit covers the open interval (0, 1). t <= 0 and t >= 1 return the
+	curve's exact end values, so the jump of the expo and elastic curves
+	at their ends is kept. maxError() reports the largest error measured
+	while fitting, which only exceeds the tolerance at segments that hit
+	the minimum width.
+	*/
+
+	class PiecewisePolynomial {
+	private:
+		std::vector<float> m_breaks;		// segment bounds, segmentCount() + 1 entries
+		std::vector<float> m_coefficients;	// COEFFICIENTS per segment, highest power first
+		float m_startValue;
+		float m_endValue;
+		float m_maxError;
+		int m_degree;
+
+		void fit(const std::function<float(float)>& curve, float tolerance);
+		void fitInterval(const std::function<float(float)>& curve, double a, double b, float tolerance);
+		std::size_t findSegment(float t) const;
+		float evaluateSegment(std::size_t segment, float t) const;
+
+	public:
+		static const int COEFFICIENTS;			// stride of the coefficient table
+		static const int MAX_DEGREE;
+		static const int CHECK_POINTS;			// error samples per segment
+		static const float DEFAULT_TOLERANCE;
+		static const float MIN_SEGMENT_WIDTH;
+
+		// degree is 1 to MAX_DEGREE
+		explicit PiecewisePolynomial(InterpFunc func, float tolerance = DEFAULT_TOLERANCE, int degree = 3);
+		explicit PiecewisePolynomial(const CompiledEasing& curve, float tolerance = DEFAULT_TOLERANCE, int degree = 3);
+		explicit PiecewisePolynomial(const std::function<float(float)>& curve,
+									 float tolerance = DEFAULT_TOLERANCE, int degree = 3);
+
+		float apply(float t) const;
+		float apply(float t, float b, float c, float d) const;
+
+		// out[i] = apply(t[i]) for count normalized times
+		void evaluate(const float* t, float* out, std::size_t count) const;
+
+		std::size_t segmentCount() const;
+		float breakpoint(std::size_t index) const;
+		int degree() const;
+		float maxError() const;
+	};
+}
+
+#endif
@@ -0,0 +1,392 @@
+#ifndef Simd_Hpp
+#define Simd_Hpp
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Wider targets default to what the compiler flags enable. A translation
+// unit built for a wider target at run time (src/engine/interpolate_batch_*.cpp)
+// enables code generation for it and defines the macro before including this.
+#if defined(__AVX512F__) && !defined(ANIMATION_SIMD_AVX512)
+	#define ANIMATION_SIMD_AVX512
+#endif
+#if (defined(__AVX2__) || defined(ANIMATION_SIMD_AVX512)) && !defined(ANIMATION_SIMD_AVX2)
+	#define ANIMATION_SIMD_AVX2
+#endif
+
+#if defined(ANIMATION_SIMD_AVX2)
+	#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define ANIMATION_SIMD_SSE2
+#elif defined(ANIMATION_SIMD_NEON) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#ifndef ANIMATION_SIMD_NEON
+		#define ANIMATION_SIMD_NEON
+	#endif
+#endif
+
+// Each target gets its own inline namespace so the same inline functions
+// built with different instruction sets never merge at link time
+#if defined(ANIMATION_SIMD_AVX512)
+	#define ANIMATION_SIMD_ABI avx512
+#elif defined(ANIMATION_SIMD_AVX2)
+	#define ANIMATION_SIMD_ABI avx2
+#elif defined(ANIMATION_SIMD_SSE2)
+	#define ANIMATION_SIMD_ABI sse2
+#elif defined(ANIMATION_SIMD_NEON)
+	#define ANIMATION_SIMD_ABI neon
+#else
+	#define ANIMATION_SIMD_ABI scalar
+#endif
+
+namespace animation {
+namespace simd {
+inline namespace ANIMATION_SIMD_ABI {
+
+	/**
+	Minimal float lane types used by the batch easing kernels.
+
+	Every lane type provides the same set of free functions (load, store,
+	broadcast, arithmetic, comparisons returning a mask, select, floor,
+	sqrt and pow2i) so a kernel written once as a template compiles for
+	plain floats, SSE2, AVX2, AVX-512 and NEON registers.
+	*/
+
+	// ------------------------------------------------------------------
+	// Scalar lane - always available, used for loop tails
+	// ------------------------------------------------------------------
+
+	struct f32x1 {
+		typedef bool mask_type;
+		static constexpr int width = 1;
+		float v;
+	};
+
+	inline f32x1 load(const float* p, f32x1)        { return { *p }; }
+	inline void  store(float* p, f32x1 a)           { *p = a.v; }
+	inline f32x1 broadcast(float x, f32x1)          { return { x }; }
+
+	inline f32x1 operator+ (f32x1 a, f32x1 b) { return { a.v + b.v }; }
+	inline f32x1 operator- (f32x1 a, f32x1 b) { return { a.v - b.v }; }
+	inline f32x1 operator* (f32x1 a, f32x1 b) { return { a.v * b.v }; }
+	inline f32x1 operator/ (f32x1 a, f32x1 b) { return { a.v / b.v }; }
+	inline f32x1 operator- (f32x1 a)          { return { -a.v }; }
+
+	inline bool operator< (f32x1 a, f32x1 b)  { return a.v < b.v; }
+	inline bool operator>=(f32x1 a, f32x1 b)  { return a.v >= b.v; }
+	inline bool operator==(f32x1 a, f32x1 b)  { return a.v == b.v; }
+
+	inline f32x1 select(bool m, f32x1 a, f32x1 b) { return m ? a : b; }
+	inline f32x1 min(f32x1 a, f32x1 b)  { return { a.v < b.v ? a.v : b.v }; }
+	inline f32x1 max(f32x1 a, f32x1 b)  { return { a.v > b.v ? a.v : b.v }; }
+	inline f32x1 sqrt(f32x1 a)          { return { std::sqrt(a.v) }; }
+	inline f32x1 floor(f32x1 a)         { return { std::floor(a.v) }; }
+
+	// 2^n for an integral valued n in [-126, 127]
+	inline f32x1 pow2i(f32x1 n) {
+		std::int32_t bits = (static_cast<std::int32_t>(n.v) + 127) << 23;
+		float r;
+		std::memcpy(&r, &bits, sizeof(r));
+		return { r };
+	}
+
+	// ------------------------------------------------------------------
+	// SSE2 - 4 lanes
+	// ------------------------------------------------------------------
+
+#if defined(ANIMATION_SIMD_SSE2)
+	struct f32x4 {
+		typedef f32x4 mask_type;
+		static constexpr int width = 4;
+		__m128 v;
+	};
+
+	inline f32x4 load(const float* p, f32x4)        { return { _mm_loadu_ps(p) }; }
+	inline void  store(float* p, f32x4 a)           { _mm_storeu_ps(p, a.v); }
+	inline f32x4 broadcast(float x, f32x4)          { return { _mm_set1_ps(x) }; }
+
+	inline f32x4 operator+ (f32x4 a, f32x4 b) { return { _mm_add_ps(a.v, b.v) }; }
+	inline f32x4 operator- (f32x4 a, f32x4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+	inline f32x4 operator* (f32x4 a, f32x4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+	inline f32x4 operator/ (f32x4 a, f32x4 b) { return { _mm_div_ps(a.v, b.v) }; }
+	inline f32x4 operator- (f32x4 a)          { return { _mm_xor_ps(a.v, _mm_set1_ps(-0.f)) }; }
+
+	inline f32x4 operator< (f32x4 a, f32x4 b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+	inline f32x4 operator>=(f32x4 a, f32x4 b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+	inline f32x4 operator==(f32x4 a, f32x4 b) { return { _mm_cmpeq_ps(a.v, b.v) }; }
+	inline f32x4 operator| (f32x4 a, f32x4 b) { return { _mm_or_ps(a.v, b.v) }; }
+
+	inline f32x4 select(f32x4 m, f32x4 a, f32x4 b) {
+		return { _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)) };
+	}
+	inline f32x4 min(f32x4 a, f32x4 b)  { return { _mm_min_ps(a.v, b.v) }; }
+	inline f32x4 max(f32x4 a, f32x4 b)  { return { _mm_max_ps(a.v, b.v) }; }
+	inline f32x4 sqrt(f32x4 a)          { return { _mm_sqrt_ps(a.v) }; }
+
+	// SSE2 has no round instruction: truncate, then step down for negative fractions
+	inline f32x4 floor(f32x4 a) {
+		__m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+		__m128 fix = _mm_and_ps(_mm_cmpgt_ps(t, a.v), _mm_set1_ps(1.f));
+		return { _mm_sub_ps(t, fix) };
+	}
+
+	inline f32x4 pow2i(f32x4 n) {
+		__m128i e = _mm_add_epi32(_mm_cvtps_epi32(n.v), _mm_set1_epi32(127));
+		return { _mm_castsi128_ps(_mm_slli_epi32(e, 23)) };
+	}
+#endif
+
+	// ------------------------------------------------------------------
+	// NEON - 4 lanes (ARMv7 on the Raspberry Pi, AArch64 elsewhere)
+	// ------------------------------------------------------------------
+
+#if defined(ANIMATION_SIMD_NEON)
+	struct f32x4 {
+		struct mask_type { uint32x4_t v; };
+		static constexpr int width = 4;
+		float32x4_t v;
+	};
+
+	inline f32x4 load(const float* p, f32x4)        { return { vld1q_f32(p) }; }
+	inline void  store(float* p, f32x4 a)           { vst1q_f32(p, a.v); }
+	inline f32x4 broadcast(float x, f32x4)          { return { vdupq_n_f32(x) }; }
+
+	inline f32x4 operator+ (f32x4 a, f32x4 b) { return { vaddq_f32(a.v, b.v) }; }
+	inline f32x4 operator- (f32x4 a, f32x4 b) { return { vsubq_f32(a.v, b.v) }; }
+	inline f32x4 operator* (f32x4 a, f32x4 b) { return { vmulq_f32(a.v, b.v) }; }
+	inline f32x4 operator- (f32x4 a)          { return { vnegq_f32(a.v) }; }
+
+	inline f32x4 operator/ (f32x4 a, f32x4 b) {
+	#if defined(__aarch64__)
+		return { vdivq_f32(a.v, b.v) };
+	#else
+		// ARMv7 has no vector divide: refine the reciprocal estimate twice
+		float32x4_t r = vrecpeq_f32(b.v);
+		r = vmulq_f32(vrecpsq_f32(b.v, r), r);
+		r = vmulq_f32(vrecpsq_f32(b.v, r), r);
+		return { vmulq_f32(a.v, r) };
+	#endif
+	}
+
+	inline f32x4::mask_type operator< (f32x4 a, f32x4 b) { return { vcltq_f32(a.v, b.v) }; }
+	inline f32x4::mask_type operator>=(f32x4 a, f32x4 b) { return { vcgeq_f32(a.v, b.v) }; }
+	inline f32x4::mask_type operator==(f32x4 a, f32x4 b) { return { vceqq_f32(a.v, b.v) }; }
+	inline f32x4::mask_type operator| (f32x4::mask_type a, f32x4::mask_type b) { return { vorrq_u32(a.v, b.v) }; }
+
+	inline f32x4 select(f32x4::mask_type m, f32x4 a, f32x4 b) { return { vbslq_f32(m.v, a.v, b.v) }; }
+	inline f32x4 min(f32x4 a, f32x4 b)  { return { vminq_f32(a.v, b.v) }; }
+	inline f32x4 max(f32x4 a, f32x4 b)  { return { vmaxq_f32(a.v, b.v) }; }
+
+	inline f32x4 sqrt(f32x4 a) {
+	#if defined(__aarch64__)
+		return { vsqrtq_f32(a.v) };
+	#else
+		// sqrt(x) = x * rsqrt(x), with x == 0 masked to avoid 0 * inf
+		float32x4_t r = vrsqrteq_f32(a.v);
+		r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(a.v, r), r), r);
+		r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(a.v, r), r), r);
+		float32x4_t s = vmulq_f32(a.v, r);
+		return { vbslq_f32(vceqq_f32(a.v, vdupq_n_f32(0.f)), vdupq_n_f32(0.f), s) };
+	#endif
+	}
+
+	inline f32x4 floor(f32x4 a) {
+		float32x4_t t = vcvtq_f32_s32(vcvtq_s32_f32(a.v));
+		float32x4_t fix = vbslq_f32(vcgtq_f32(t, a.v), vdupq_n_f32(1.f), vdupq_n_f32(0.f));
+		return { vsubq_f32(t, fix) };
+	}
+
+	inline f32x4 pow2i(f32x4 n) {
+		int32x4_t e = vaddq_s32(vcvtq_s32_f32(n.v), vdupq_n_s32(127));
+		return { vreinterpretq_f32_s32(vshlq_n_s32(e, 23)) };
+	}
+#endif
+
+	// ------------------------------------------------------------------
+	// AVX2 - 8 lanes
+	// ------------------------------------------------------------------
+
+#if defined(ANIMATION_SIMD_AVX2)
+	struct f32x8 {
+		typedef f32x8 mask_type;
+		static constexpr int width = 8;
+		__m256 v;
+	};
+
+	inline f32x8 load(const float* p, f32x8)        { return { _mm256_loadu_ps(p) }; }
+	inline void  store(float* p, f32x8 a)           { _mm256_storeu_ps(p, a.v); }
+	inline f32x8 broadcast(float x, f32x8)          { return { _mm256_set1_ps(x) }; }
+
+	inline f32x8 operator+ (f32x8 a, f32x8 b) { return { _mm256_add_ps(a.v, b.v) }; }
+	inline f32x8 operator- (f32x8 a, f32x8 b) { return { _mm256_sub_ps(a.v, b.v) }; }
+	inline f32x8 operator* (f32x8 a, f32x8 b) { return { _mm256_mul_ps(a.v, b.v) }; }
+	inline f32x8 operator/ (f32x8 a, f32x8 b) { return { _mm256_div_ps(a.v, b.v) }; }
+	inline f32x8 operator- (f32x8 a)          { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.f)) }; }
+
+	inline f32x8 operator< (f32x8 a, f32x8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+	inline f32x8 operator>=(f32x8 a, f32x8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+	inline f32x8 operator==(f32x8 a, f32x8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+	inline f32x8 operator| (f32x8 a, f32x8 b) { return { _mm256_or_ps(a.v, b.v) }; }
+
+	inline f32x8 select(f32x8 m, f32x8 a, f32x8 b) { return { _mm256_blendv_ps(b.v, a.v, m.v) }; }
+	inline f32x8 min(f32x8 a, f32x8 b)  { return { _mm256_min_ps(a.v, b.v) }; }
+	inline f32x8 max(f32x8 a, f32x8 b)  { return { _mm256_max_ps(a.v, b.v) }; }
+	inline f32x8 sqrt(f32x8 a)          { return { _mm256_sqrt_ps(a.v) }; }
+	inline f32x8 floor(f32x8 a)         { return { _mm256_floor_ps(a.v) }; }
+
+	inline f32x8 pow2i(f32x8 n) {
+		__m256i e = _mm256_add_epi32(_mm256_cvtps_epi32(n.v), _mm256_set1_epi32(127));
+		return { _mm256_castsi256_ps(_mm256_slli_epi32(e, 23)) };
+	}
+#endif
+
+	// ------------------------------------------------------------------
+	// AVX-512F - 16 lanes, comparisons produce a k-register mask
+	// ------------------------------------------------------------------
+
+#if defined(ANIMATION_SIMD_AVX512)
+	// GCC 12's _mm512_undefined_ps() self-initialises its result, which
+	// warns through every unmasked AVX-512 intrinsic (GCC bug 105593)
+	#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 13
+		#pragma GCC diagnostic push
+		#pragma GCC diagnostic ignored "-Wuninitialized"
+		#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+	#endif
+
+	struct f32x16 {
+		struct mask_type { __mmask16 v; };
+		static constexpr int width = 16;
+		__m512 v;
+	};
+
+	inline f32x16 load(const float* p, f32x16)      { return { _mm512_loadu_ps(p) }; }
+	inline void   store(float* p, f32x16 a)         { _mm512_storeu_ps(p, a.v); }
+	inline f32x16 broadcast(float x, f32x16)        { return { _mm512_set1_ps(x) }; }
+
+	inline f32x16 operator+ (f32x16 a, f32x16 b) { return { _mm512_add_ps(a.v, b.v) }; }
+	inline f32x16 operator- (f32x16 a, f32x16 b) { return { _mm512_sub_ps(a.v, b.v) }; }
+	inline f32x16 operator* (f32x16 a, f32x16 b) { return { _mm512_mul_ps(a.v, b.v) }; }
+	inline f32x16 operator/ (f32x16 a, f32x16 b) { return { _mm512_div_ps(a.v, b.v) }; }
+
+	// Float xor needs AVX-512DQ; flip the sign bit as an integer instead
+	inline f32x16 operator- (f32x16 a) {
+		return { _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.v), _mm512_set1_epi32(INT32_MIN))) };
+	}
+
+	inline f32x16::mask_type operator< (f32x16 a, f32x16 b) { return { _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ) }; }
+	inline f32x16::mask_type operator>=(f32x16 a, f32x16 b) { return { _mm512_cmp_ps_mask(a.v, b.v, _CMP_GE_OQ) }; }
+	inline f32x16::mask_type operator==(f32x16 a, f32x16 b) { return { _mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ) }; }
+	inline f32x16::mask_type operator| (f32x16::mask_type a, f32x16::mask_type b) {
+		return { static_cast<__mmask16>(a.v | b.v) };
+	}
+
+	inline f32x16 select(f32x16::mask_type m, f32x16 a, f32x16 b) { return { _mm512_mask_blend_ps(m.v, b.v, a.v) }; }
+	inline f32x16 min(f32x16 a, f32x16 b)  { return { _mm512_min_ps(a.v, b.v) }; }
+	inline f32x16 max(f32x16 a, f32x16 b)  { return { _mm512_max_ps(a.v, b.v) }; }
+	inline f32x16 sqrt(f32x16 a)           { return { _mm512_sqrt_ps(a.v) }; }
+	inline f32x16 floor(f32x16 a) {
+		return { _mm512_roundscale_ps(a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) };
+	}
+
+	inline f32x16 pow2i(f32x16 n) {
+		__m512i e = _mm512_add_epi32(_mm512_cvtps_epi32(n.v), _mm512_set1_epi32(127));
+		return { _mm512_castsi512_ps(_mm512_slli_epi32(e, 23)) };
+	}
+
+	#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 13
+		#pragma GCC diagnostic pop
+	#endif
+#endif
+
+	// ------------------------------------------------------------------
+	// Widest lane type enabled for this translation unit
+	// ------------------------------------------------------------------
+
+#if defined(ANIMATION_SIMD_AVX512)
+	typedef f32x16 native;
+	#define ANIMATION_SIMD_NAME "AVX512"
+#elif defined(ANIMATION_SIMD_AVX2)
+	typedef f32x8 native;
+	#define ANIMATION_SIMD_NAME "AVX2"
+#elif defined(ANIMATION_SIMD_SSE2)
+	typedef f32x4 native;
+	#define ANIMATION_SIMD_NAME "SSE2"
+#elif defined(ANIMATION_SIMD_NEON)
+	typedef f32x4 native;
+	#define ANIMATION_SIMD_NAME "NEON"
+#else
+	typedef f32x1 native;
+	#define ANIMATION_SIMD_NAME "Scalar"
+#endif
+
+	// ------------------------------------------------------------------
+	// Transcendentals shared by every lane type
+	// ------------------------------------------------------------------
+
+	template<class V>
+	inline V splat(float x) {
+		return broadcast(x, V());
+	}
+
+	/** 2^x, Cephes polynomial on [-0.5, 0.5] (max relative error ~2e-7).
+	*/
+	template<class V>
+	inline V exp2(V x) {
+		x = min(max(x, splat<V>(-126.f)), splat<V>(126.f));
+		V n = floor(x + splat<V>(0.5f));
+		V f = x - n;
+
+		V p = splat<V>(1.535336188319500e-4f);
+		p = p * f + splat<V>(1.339887440266574e-3f);
+		p = p * f + splat<V>(9.618437357674640e-3f);
+		p = p * f + splat<V>(5.550332471162809e-2f);
+		p = p * f + splat<V>(2.402264791363012e-1f);
+		p = p * f + splat<V>(6.931472028550421e-1f);
+		p = p * f + splat<V>(1.f);
+
+		return p * pow2i(n);
+	}
+
+	/** sin(x), quadrant reduction by pi/2 with Cephes polynomials
+	(max absolute error ~1e-7 for |x| < 100).
+	*/
+	template<class V>
+	inline V sin(V x) {
+		V k = floor(x * splat<V>(0.636619772f) + splat<V>(0.5f));
+
+		// Extended precision reduction: r = x - k * pi/2
+		V r = x - k * splat<V>(1.5703125f);
+		r = r - k * splat<V>(4.837512969970703125e-4f);
+		r = r - k * splat<V>(7.549789948768648e-8f);
+
+		V z = r * r;
+
+		V s = splat<V>(-1.9515295891e-4f);
+		s = s * z + splat<V>(8.3321608736e-3f);
+		s = s * z + splat<V>(-1.6666654611e-1f);
+		s = s * z * r + r;
+
+		V c = splat<V>(2.443315711809948e-5f);
+		c = c * z + splat<V>(-1.388731625493765e-3f);
+		c = c * z + splat<V>(4.166664568298827e-2f);
+		c = c * z * z - splat<V>(0.5f) * z + splat<V>(1.f);
+
+		// Quadrant q = k mod 4: odd quadrants use cos, quadrants 2 and 3 negate
+		V q = k - splat<V>(4.f) * floor(k * splat<V>(0.25f));
+		V odd = q - splat<V>(2.f) * floor(q * splat<V>(0.5f));
+		V y = select(odd == splat<V>(1.f), c, s);
+		return select(q >= splat<V>(2.f), -y, y);
+	}
+
+	template<class V>
+	inline V cos(V x) {
+		return sin(x + splat<V>(1.57079632679f));
+	}
+}
+}
+}
+
+#endif
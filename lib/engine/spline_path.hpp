@@ -0,0 +1,82 @@
+#ifndef SplinePath_Hpp
+#define SplinePath_Hpp
+
+#include <cstddef>
+#include <vector>
+#include <SFML/Graphics.hpp>
+#include "engine/interp_func.hpp"
+
+namespace animation {
+
+	enum class SplineType {
+		CatmullRom = 1,		// passes through every point
+		Bezier = 2			// cubic chain: p0, c0, c1, p1, c2, c3, p2, ...
+	};
+
+	/** Playback position along a SplinePath.
+
+	Each follower keeps its own cursor so one path can be shared.
+	*/
+	struct SplineCursor {
+		std::size_t sample = 0;
+	};
+
+	/**
+	2D spline path parameterized by arc length.
+
+	Every segment is sampled SAMPLES_PER_SEGMENT times when the path is
+	built and the cumulative chord lengths are stored. A distance along
+	the path maps to a spline parameter through that table (binary
+	search, or a forward step from a cursor for sequential playback). The
+	cursor is O(1) while a follower moves at most two samples per call;
+	longer jumps fall back to the O(log n) search. The position is then
+	evaluated on the curve itself, so points always lie exactly on the
+	spline. Easing the distance instead of the raw parameter gives a
+	constant speed for linear easing, however the control points are
+	spaced.
+
+	Catmull-Rom paths are uniform and pass through every point; the end
+	points are repeated to give the first and last segments a tangent.
+	Paths are immutable once built and can be shared by any number of
+	followers.
+	*/
+
+	class SplinePath {
+	private:
+		SplineType m_type;
+		std::vector<sf::Vector2f> m_points;
+		std::vector<float> m_lengths;	// distance at each sample, segmentCount() * samples + 1
+		std::size_t m_samplesPerSegment;
+
+		std::size_t findSample(float distance) const;
+		float parameterAt(std::size_t sample, float distance) const;
+
+	public:
+		static const std::size_t DEFAULT_SAMPLES_PER_SEGMENT;
+
+		SplinePath(SplineType type, const std::vector<sf::Vector2f>& points,
+				   std::size_t samplesPerSegment = DEFAULT_SAMPLES_PER_SEGMENT);
+
+		SplineType type() const;
+		std::size_t segmentCount() const;
+		float length() const;
+
+		// Point at a spline parameter in [0, segmentCount()]
+		sf::Vector2f pointAtParameter(float u) const;
+
+		// Point at a distance from the start, clamped to [0, length()]
+		sf::Vector2f positionAt(float distance) const;
+		sf::Vector2f positionAt(float distance, SplineCursor& cursor) const;
+
+		// Unit direction of travel at a distance
+		sf::Vector2f tangentAt(float distance) const;
+
+		// Position after easing normalized time t into distance travelled
+		sf::Vector2f evaluate(InterpFunc func, float t, SplineCursor& cursor) const;
+
+		// out[i] = positionAt(distances[i], cursor) for count distances
+		void evaluate(const float* distances, sf::Vector2f* out, std::size_t count, SplineCursor& cursor) const;
+	};
+}
+
+#endif
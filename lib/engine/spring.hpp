@@ -0,0 +1,90 @@
+#ifndef Spring_Hpp
+#define Spring_Hpp
+
+#include <cstddef>
+
+namespace animation {
+
+	// Damping regime of a Spring, from its damping ratio
+	enum class SpringRegime {
+		Underdamped = 1,	// ratio < 1, oscillates around the target
+		Critical = 2,		// ratio == 1, fastest approach without overshoot
+		Overdamped = 3		// ratio > 1, creeps in without overshoot
+	};
+
+	/**
+	Damped spring easing solved in closed form.
+
+	A mass on a spring with the given stiffness and damping starts one
+	unit away from its target (optionally moving toward it) and settles
+	on it. The displacement is written analytically for each damping
+	regime, so the curve is a pure function of time like the Interpolate
+	functions: no per-object integration state and nothing to step.
+
+	apply(t) is normalized over settleDuration(), the time after which
+	the spring stays within SETTLE_TOLERANCE of its target. Giving a Tween
+	that duration plays the spring at its physical speed; other durations
+	time-scale it. position() evaluates at an absolute time in seconds.
+
+	Springs are immutable once built and can be shared between tweens.
+	evaluate() runs a batch with the simd lane types from engine/simd.hpp.
+	*/
+
+	class Spring {
+	private:
+		SpringRegime m_regime;
+		float m_omega;		// undamped angular frequency sqrt(k / m)
+		float m_ratio;		// damping ratio c / (2 sqrt(k m))
+		float m_decay;		// envelope decay rate (underdamped, critical) or slow root
+		float m_freq;		// damped frequency (underdamped) or fast root (overdamped)
+		float m_a;			// displacement coefficients, see displacement()
+		float m_b;
+		float m_stiffness;
+		float m_damping;
+		float m_mass;
+		float m_duration;
+
+		float displacement(float seconds) const;
+		float displacementVelocity(float seconds) const;
+		float settleTime(float tolerance) const;
+
+	public:
+		static const float SETTLE_TOLERANCE;
+
+		/** stiffness, damping and mass must be positive. initialVelocity is
+		in distances per second toward the target, so a tween that is
+		re-targeted mid-flight can keep its momentum.
+		*/
+		Spring(float stiffness, float damping, float mass = 1.f, float initialVelocity = 0.f);
+
+		// Normalized evaluation over settleDuration(); t outside [0, 1] returns the end points
+		float apply(float t) const;
+
+		// Same as the Interpolate (t, b, c, d) overloads
+		float apply(float t, float b, float c, float d) const;
+
+		// Eased value at an absolute time in seconds
+		float position(float seconds) const;
+
+		// First and second derivative per unit of normalized time
+		float velocity(float t) const;
+		float acceleration(float t) const;
+
+		// Earliest normalized time at which the spring reaches value on its
+		// first approach; values beyond the first overshoot map to its peak
+		float inverse(float value) const;
+
+		// out[i] = apply(t[i]) for count normalized times
+		void evaluate(const float* t, float* out, std::size_t count) const;
+
+		// Seconds until the spring stays within tolerance of its target
+		float settleDuration() const;
+		static float settleDuration(float stiffness, float damping, float mass = 1.f,
+									float initialVelocity = 0.f, float tolerance = SETTLE_TOLERANCE);
+
+		SpringRegime regime() const;
+		float dampingRatio() const;
+	};
+}
+
+#endif
@@ -1,62 +1,36 @@
 #ifndef Tween_Hpp
 #define Tween_Hpp
 
-enum class InterpFunc {
-	Linear = 1,
+#include "engine/interp_func.hpp"
 
-	QuadEaseIn = 2,
-	QuadEaseOut = 3,
-	QuadEaseInOut = 4,
-
-	CubicEaseIn = 5,
-	CubicEaseOut = 6,
-	CubicEaseInOut = 7,
-
-	QuartEaseIn = 8,
-	QuartEaseOut = 9,
-	QuartEaseInOut = 10,
-
-	QuintEaseIn = 11,
-	QuintEaseOut = 12,
-	QuintEaseInOut = 13,
-
-	SineEaseIn = 14,
-	SineEaseOut = 15,
-	SineEaseInOut = 16,
-
-	ExpoEaseIn = 17,
-	ExpoEaseOut = 18,
-	ExpoEaseInOut = 19,
-
-	CircEaseIn = 20,
-	CircEaseOut = 21,
-	CircEaseInOut = 22,
-
-	BackEaseIn = 23,
-	BackEaseOut = 24,
-	BackEaseInOut = 25,
-
-	ElasticEaseIn = 26,
-	ElasticEaseOut = 27,
-	ElasticEaseInOut = 28,
-
-	BounceEaseIn = 29,
-	BounceEaseOut = 30,
-	BounceEaseInOut = 31
-};
+namespace animation { class CubicBezier; class Spring; }
 
 class Tween {
+	// Math policy used when a tween is left on EasingPrecision::Default
+	static EasingPrecision s_defaultPrecision;
+
 	// Reference to the property being animated
 	float* m_property;
 
 	InterpFunc m_function;
 
+	// Optional bezier curve used instead of m_function (not owned)
+	const animation::CubicBezier* m_bezier;
+
+	// Optional closed-form spring used instead of m_function (not owned)
+	const animation::Spring* m_spring;
+
     float m_startValue;
     float m_targetValue;
 	float m_changeValue;
     float m_duration;
     float m_elapsedTime;
     bool  m_isAnimating;
+	bool  m_useTable;
+	EasingPrecision m_precision;
+
+	// Eased value at elapsed time t with the current curve options
+	float valueAt(float t) const;
 
 public:
     // Default constructor where members should be initialised
@@ -71,6 +45,33 @@ public:
 		  float duration,
 		  InterpFunc function=InterpFunc::BounceEaseOut);
 
+	// Animates along a shared bezier curve, which must outlive the tween.
+	Tween(float* property,
+		  float startValue,
+		  float targetValue,
+		  float duration,
+		  const animation::CubicBezier& curve);
+
+	// Only the address of the curve is kept, so a temporary would dangle
+	Tween(float* property,
+		  float startValue,
+		  float targetValue,
+		  float duration,
+		  animation::CubicBezier&& curve) = delete;
+
+	// Animates with a shared spring, which must outlive the tween. The
+	// duration is the spring's settleDuration().
+	Tween(float* property,
+		  float startValue,
+		  float targetValue,
+		  const animation::Spring& spring);
+
+	// Only the address of the spring is kept, so a temporary would dangle
+	Tween(float* property,
+		  float startValue,
+		  float targetValue,
+		  animation::Spring&& spring) = delete;
+
 	// Disable copy constructor and assignment operator
 	Tween& operator= (const Tween&) = delete;
 	Tween(const Tween&) = delete;
@@ -82,6 +83,40 @@ public:
 	void stop();
 	bool isAnimating() const;
 	void update(float dt);
+
+	// Rate of change of the property in units per second (and per second
+	// squared) at the current elapsed time; zero when not animating.
+	float getVelocity() const;
+	float getAcceleration() const;
+
+	// Moves the elapsed time to the earliest point where the curve passes
+	// through value, so a tween can resume from a property's current value
+	// without a jump. The property is set to value.
+	void seekToValue(float value);
+
+	// Moves the elapsed time to elapsedTime, clamped to the duration, and
+	// sets the property to the curve's value there.
+	void seek(float elapsedTime);
+	float getElapsedTime() const;
+
+	// Replaces the easing function with a shared bezier curve; pass
+	// nullptr to go back to the InterpFunc.
+	void setCurve(const animation::CubicBezier* curve);
+
+	// Same for a spring; the duration is left unchanged.
+	void setSpring(const animation::Spring* spring);
+
+	// Evaluate through the shared EasingTable instead of the exact curve.
+	// The tables are built with default settings on first use.
+	void useTable(bool b);
+
+	// Math policy for the sine, expo and elastic curves. Default follows
+	// the global setting below.
+	void setPrecision(EasingPrecision precision);
+	EasingPrecision getPrecision() const;
+
+	static void setDefaultPrecision(EasingPrecision precision);
+	static EasingPrecision getDefaultPrecision();
 };
 
 #endif
\ No newline at end of file
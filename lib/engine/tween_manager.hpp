@@ -0,0 +1,139 @@
+#ifndef TweenManager_Hpp
+#define TweenManager_Hpp
+
+#include <cstddef>
+#include <vector>
+#include "engine/aligned_allocator.hpp"
+#include "engine/interp_func.hpp"
+
+namespace animation { class JobSystem; }
+
+/**
+Central store for fire-and-forget float tweens.
+
+Tweens are bucketed by InterpFunc, and each field of a tween lives in
+its own contiguous array within its bucket (property, start, change,
+target, duration and elapsed time). update() picks the curve once per
+bucket and then runs one tight loop over it, instead of switching on the
+function for every tween or chasing a heap-allocated Tween per
+animation. A tween starts animating as soon as it is added; when it
+reaches its duration the property takes the exact target value and the
+tween is swap-removed from its bucket.
+
+Tweens here use an InterpFunc with the precision from
+Tween::getDefaultPrecision(). Under Fast and Fastest each bucket is
+evaluated by Interpolate::evaluate(), on the kernels picked at run time
+for the CPU, so both policies give FastMath accuracy. Bezier curves,
+springs, tables and pausing need a Tween.
+
+update(dt, jobs) spreads the curve evaluation over a JobSystem in
+chunks of CHUNK_SIZE tweens. The arrays are cache-line aligned and
+CHUNK_SIZE is a multiple of the line size, so no two threads write to
+the same line. The properties are then written on the calling thread in
+the same order as update(dt), so both give identical results for any
+thread count.
+
+The animated properties must outlive their tweens. When two tweens
+animate the same property, either may win; stop() the old one before
+adding its replacement.
+*/
+
+class TweenManager {
+	typedef std::vector<float, animation::AlignedAllocator<float>> FloatArray;
+	typedef std::vector<float*, animation::AlignedAllocator<float*>> PropertyArray;
+
+	// Parallel arrays, one element per running tween with the same function
+	struct Bucket {
+		PropertyArray properties;
+		FloatArray    startValues;
+		FloatArray    changeValues;
+		FloatArray    targetValues;
+		FloatArray    durations;
+		FloatArray    elapsedTimes;
+
+		// Eased values from the last update, before they are written out
+		FloatArray    values;
+	};
+
+	// Tweens [begin, end) of one bucket, evaluated by one job
+	struct Chunk {
+		std::size_t bucket;
+		std::size_t begin;
+		std::size_t end;
+	};
+
+	// Indexed by InterpFunc id - 1; unknown ids share QuartEaseOut's bucket
+	// like easing::dispatch()
+	Bucket m_buckets[INTERP_FUNC_COUNT];
+
+	// Work list for update(dt, jobs), kept to reuse its capacity
+	std::vector<Chunk> m_chunks;
+
+	// Array reallocations by add(), reserve() and update(dt, jobs)
+	std::size_t m_allocations;
+
+	static std::size_t bucketIndex(InterpFunc function);
+
+	// Moves the bucket's last tween into index's slot and drops the last slot
+	static void remove(Bucket& bucket, std::size_t index);
+
+	template<class M>
+	void updateBuckets(float dt, animation::JobSystem* jobs);
+
+	// Advances tweens [begin, end) of bucket and evaluates them into its values
+	template<class M>
+	static void advance(Bucket& bucket, InterpFunc function, std::size_t begin, std::size_t end, float dt);
+
+	// Writes the values out, or the targets of finished tweens, and compacts
+	static void finish(Bucket& bucket);
+
+public:
+	// Tweens per job in update(dt, jobs); a multiple of the cache line in floats
+	static const std::size_t CHUNK_SIZE;
+
+	TweenManager();
+
+	// The arrays hold raw property pointers; a copy would animate them twice
+	TweenManager& operator= (const TweenManager&) = delete;
+	TweenManager(const TweenManager&) = delete;
+
+	// Starts animating property from startValue to targetValue; a tween
+	// resumed part-way along its curve passes the time it has already run
+	// (see EasingInverse)
+	void add(float* property,
+			 float startValue,
+			 float targetValue,
+			 float duration,
+			 InterpFunc function=InterpFunc::BounceEaseOut,
+			 float elapsedTime=0.f);
+
+	// Advances every tween by dt and writes the eased values
+	void update(float dt);
+
+	// Same, evaluating the curves on jobs' threads
+	void update(float dt, animation::JobSystem& jobs);
+
+	// Removes the tweens animating property, leaving its current value;
+	// returns how many were removed
+	std::size_t stop(const float* property);
+	bool isAnimating(const float* property) const;
+
+	// Removes every tween; properties keep their current values
+	void clear();
+
+	// Avoids reallocation while up to count tweens per function are running
+	void reserve(std::size_t count);
+
+	std::size_t size() const;
+	bool empty() const;
+
+	// Running tweens that use function, i.e. the size of its bucket
+	std::size_t size(InterpFunc function) const;
+
+	// Heap allocations made by the bucket arrays. Finished and stopped
+	// tweens leave their capacity behind, so this stays constant once
+	// every bucket has seen its peak count.
+	std::size_t allocationCount() const;
+};
+
+#endif
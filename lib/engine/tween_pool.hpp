@@ -0,0 +1,285 @@
+#ifndef TweenPool_Hpp
+#define TweenPool_Hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+Reference to a tween in a TweenPool: a slot index plus the generation the
+slot had when the tween was created, 64 bits in all.
+
+Releasing a tween moves its slot on to the next generation, so handles to
+it stop resolving instead of dangling, even after the slot is reused. A
+default-constructed handle is null and never valid.
+*/
+struct TweenHandle {
+	std::uint32_t index;
+	std::uint32_t generation;
+
+	TweenHandle() : index(0), generation(0) {}
+	TweenHandle(std::uint32_t index, std::uint32_t generation)
+		: index(index), generation(generation) {}
+
+	bool isNull() const { return generation == 0; }
+
+	bool operator== (const TweenHandle& other) const {
+		return index == other.index && generation == other.generation;
+	}
+	bool operator!= (const TweenHandle& other) const { return !(*this == other); }
+};
+
+// What a TweenPool does when create() finds every slot in use
+enum class PoolGrowth {
+	// Fail: create() returns a null handle and the pool never allocates
+	// after construction
+	Fixed = 0,
+
+	// Allocate another block of the pool's block size
+	Grow = 1
+};
+
+/**
+Pooled store for tweens of type T (Tween, ValueTween<...>) addressed by
+TweenHandle.
+
+Tweens are constructed in place in blocks of slots, so they never move
+once created; ValueTween points into itself and relies on that. The
+first block holds the capacity given to the constructor (or
+DEFAULT_BLOCK_SIZE slots, allocated on first use) and later blocks, if
+the growth policy allows them, are the same size. Released slots go on a
+free list and are reused by later tweens, so once the pool has grown to
+its peak number of live tweens, create() and release do no heap
+allocation; allocationCount() lets tests check that. Handle lookups are
+O(1): a bounds check and a generation compare.
+
+update() advances every live tween and releases the ones that finish
+during it. A tween that is paused with T::stop() keeps its slot until
+stop(handle) or clear() is called.
+*/
+
+template<class T>
+class TweenPool {
+	static constexpr std::uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+	struct Slot {
+		alignas(T) unsigned char storage[sizeof(T)];
+
+		// Generation of the current, or next, tween in this slot; never 0
+		std::uint32_t generation;
+		bool live;
+
+		// Next slot on the free list while not live
+		std::uint32_t nextFree;
+
+		T* tween() { return reinterpret_cast<T*>(storage); }
+		const T* tween() const { return reinterpret_cast<const T*>(storage); }
+	};
+
+	std::vector<std::unique_ptr<Slot[]>> m_blocks;
+	std::uint32_t m_blockSize;
+	PoolGrowth m_growth;
+
+	std::uint32_t m_slotCount;
+	std::uint32_t m_freeHead;
+	std::size_t m_size;
+
+	// Stats
+	std::size_t m_highWaterMark;
+	std::size_t m_allocations;
+	std::size_t m_failedCreates;
+
+	Slot& slot(std::uint32_t index) {
+		return m_blocks[index / m_blockSize][index % m_blockSize];
+	}
+
+	const Slot& slot(std::uint32_t index) const {
+		return m_blocks[index / m_blockSize][index % m_blockSize];
+	}
+
+	void allocateBlock() {
+		// The block list itself only reallocates when it is full
+		if (m_blocks.size() == m_blocks.capacity())
+			++m_allocations;
+
+		m_blocks.emplace_back(new Slot[m_blockSize]);
+		++m_allocations;
+	}
+
+	// Null when the handle is stale or was never issued by this pool
+	Slot* find(TweenHandle handle) {
+		if (handle.index >= m_slotCount)
+			return nullptr;
+
+		Slot& s = slot(handle.index);
+		return s.live && s.generation == handle.generation ? &s : nullptr;
+	}
+
+	const Slot* find(TweenHandle handle) const {
+		return const_cast<TweenPool*>(this)->find(handle);
+	}
+
+	std::uint32_t acquire() {
+		if (m_freeHead != NO_SLOT) {
+			std::uint32_t index = m_freeHead;
+			m_freeHead = slot(index).nextFree;
+			return index;
+		}
+
+		if (m_slotCount == capacity()) {
+			if (m_growth == PoolGrowth::Fixed)
+				return NO_SLOT;
+			allocateBlock();
+		}
+
+		std::uint32_t index = m_slotCount++;
+		slot(index).generation = 1;
+		return index;
+	}
+
+	void release(std::uint32_t index) {
+		Slot& s = slot(index);
+		s.tween()->~T();
+		s.live = false;
+
+		// Skip 0 on wrap-around so null handles stay invalid
+		if (++s.generation == 0)
+			s.generation = 1;
+
+		s.nextFree = m_freeHead;
+		m_freeHead = index;
+		--m_size;
+	}
+
+public:
+	static constexpr std::uint32_t DEFAULT_BLOCK_SIZE = 32;
+
+	// Allocates capacity slots up front when capacity is non-zero
+	explicit TweenPool(std::size_t capacity=0, PoolGrowth growth=PoolGrowth::Grow)
+		: m_blockSize(capacity > 0 ? static_cast<std::uint32_t>(capacity) : DEFAULT_BLOCK_SIZE)
+		, m_growth(growth)
+		, m_slotCount(0)
+		, m_freeHead(NO_SLOT)
+		, m_size(0)
+		, m_highWaterMark(0)
+		, m_allocations(0)
+		, m_failedCreates(0) {
+
+		if (capacity > 0)
+			allocateBlock();
+	}
+
+	~TweenPool() {
+		clear();
+	}
+
+	// Handles would refer to the same slots in both pools
+	TweenPool& operator= (const TweenPool&) = delete;
+	TweenPool(const TweenPool&) = delete;
+
+	// Constructs a T from args in a free slot; the tween is not started.
+	// Returns a null handle when a Fixed pool is full.
+	template<class... Args>
+	TweenHandle create(Args&&... args) {
+		std::uint32_t index = acquire();
+		if (index == NO_SLOT) {
+			++m_failedCreates;
+			return TweenHandle();
+		}
+
+		Slot& s = slot(index);
+
+		new (s.storage) T(std::forward<Args>(args)...);
+		s.live = true;
+		++m_size;
+
+		if (m_size > m_highWaterMark)
+			m_highWaterMark = m_size;
+
+		return TweenHandle(index, s.generation);
+	}
+
+	bool isValid(TweenHandle handle) const {
+		return find(handle) != nullptr;
+	}
+
+	// The tween, or null when the handle is stale
+	T* get(TweenHandle handle) {
+		Slot* s = find(handle);
+		return s ? s->tween() : nullptr;
+	}
+
+	const T* get(TweenHandle handle) const {
+		const Slot* s = find(handle);
+		return s ? s->tween() : nullptr;
+	}
+
+	// Releases the tween, leaving its property at the current value;
+	// false when the handle is already stale
+	bool stop(TweenHandle handle) {
+		if (!find(handle))
+			return false;
+
+		release(handle.index);
+		return true;
+	}
+
+	// Moves the tween to elapsedTime and writes the property; false when
+	// the handle is stale
+	bool seek(TweenHandle handle, float elapsedTime) {
+		T* tween = get(handle);
+		if (!tween)
+			return false;
+
+		tween->seek(elapsedTime);
+		return true;
+	}
+
+	// Advances every live tween by dt and releases those that finish
+	void update(float dt) {
+		for (std::uint32_t index = 0; index < m_slotCount; ++index) {
+			Slot& s = slot(index);
+			if (!s.live)
+				continue;
+
+			T* tween = s.tween();
+			if (!tween->isAnimating())
+				continue;
+
+			tween->update(dt);
+			if (!tween->isAnimating())
+				release(index);
+		}
+	}
+
+	// Releases every tween; properties keep their current values
+	void clear() {
+		for (std::uint32_t index = 0; index < m_slotCount; ++index) {
+			if (slot(index).live)
+				release(index);
+		}
+	}
+
+	// Live tweens
+	std::size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+
+	// Slots allocated so far, live or free
+	std::size_t capacity() const { return m_blocks.size() * m_blockSize; }
+	PoolGrowth getGrowth() const { return m_growth; }
+
+	// Most tweens live at once since construction
+	std::size_t highWaterMark() const { return m_highWaterMark; }
+
+	// Heap allocations made by the pool: slot blocks and the list that
+	// holds them. Constant once the pool is warmed up.
+	std::size_t allocationCount() const { return m_allocations; }
+
+	// create() calls that returned a null handle because a Fixed pool was full
+	std::size_t failedCreateCount() const { return m_failedCreates; }
+};
+
+#endif
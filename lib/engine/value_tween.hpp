@@ -0,0 +1,130 @@
+#ifndef ValueTween_Hpp
+#define ValueTween_Hpp
+
+#include "engine/tween.hpp"
+#include "engine/lerp_traits.hpp"
+
+/**
+Tween over any value type with a lerp trait, e.g. sf::Vector2f, sf::Color
+or sf::Transform.
+
+An inner Tween animates a single easing weight from 0 to 1 with every
+option a float tween has (InterpFunc, bezier, spring, table, precision),
+so the curve is evaluated once per update however many components the
+value has. Traits::lerp then blends the start and target values with
+that weight. The property takes the exact target value when the tween
+ends.
+*/
+
+template<class T, class Traits = animation::LerpTraits<T>>
+class ValueTween {
+	// Reference to the property being animated
+	T* m_property;
+
+	T m_startValue;
+	T m_targetValue;
+
+	// Easing weight animated by m_tween, 0 at the start and 1 at the end
+	float m_weight;
+	Tween m_tween;
+
+public:
+	ValueTween(T* property,
+			   const T& startValue,
+			   const T& targetValue,
+			   float duration,
+			   InterpFunc function=InterpFunc::BounceEaseOut)
+			: m_property(property)
+			, m_startValue(startValue)
+			, m_targetValue(targetValue)
+			, m_weight(0.f)
+			, m_tween(&m_weight, 0.f, 1.f, duration, function) {
+	}
+
+	// Shared bezier curve, which must outlive the tween
+	ValueTween(T* property,
+			   const T& startValue,
+			   const T& targetValue,
+			   float duration,
+			   const animation::CubicBezier& curve)
+			: m_property(property)
+			, m_startValue(startValue)
+			, m_targetValue(targetValue)
+			, m_weight(0.f)
+			, m_tween(&m_weight, 0.f, 1.f, duration, curve) {
+	}
+
+	ValueTween(T* property,
+			   const T& startValue,
+			   const T& targetValue,
+			   float duration,
+			   animation::CubicBezier&& curve) = delete;
+
+	// Shared spring, which must outlive the tween; the duration is the
+	// spring's settleDuration()
+	ValueTween(T* property,
+			   const T& startValue,
+			   const T& targetValue,
+			   const animation::Spring& spring)
+			: m_property(property)
+			, m_startValue(startValue)
+			, m_targetValue(targetValue)
+			, m_weight(0.f)
+			, m_tween(&m_weight, 0.f, 1.f, spring) {
+	}
+
+	ValueTween(T* property,
+			   const T& startValue,
+			   const T& targetValue,
+			   animation::Spring&& spring) = delete;
+
+	// The inner tween points at m_weight, so the tween cannot move
+	ValueTween& operator= (const ValueTween&) = delete;
+	ValueTween(const ValueTween&) = delete;
+
+	void resetAndStop() {
+		m_tween.resetAndStop();
+		(*m_property) = m_startValue;
+	}
+
+	void resetAndPlay() {
+		m_tween.resetAndPlay();
+		(*m_property) = m_startValue;
+	}
+
+	void start()             { m_tween.start(); }
+	void stop()              { m_tween.stop(); }
+	bool isAnimating() const { return m_tween.isAnimating(); }
+
+	void update(float dt) {
+		if (!m_tween.isAnimating())
+			return;
+
+		m_tween.update(dt);
+
+		(*m_property) = m_tween.isAnimating()
+			? Traits::lerp(m_startValue, m_targetValue, m_weight)
+			: m_targetValue;
+	}
+
+	// Moves to elapsedTime, clamped to the duration, and sets the property
+	void seek(float elapsedTime) {
+		m_tween.seek(elapsedTime);
+		(*m_property) = Traits::lerp(m_startValue, m_targetValue, m_weight);
+	}
+
+	// Current easing weight and its rate of change per second; the
+	// property's velocity is (target - start) * getWeightVelocity()
+	float getWeight() const         { return m_weight; }
+	float getWeightVelocity() const { return m_tween.getVelocity(); }
+
+	const T& getStartValue() const  { return m_startValue; }
+	const T& getTargetValue() const { return m_targetValue; }
+
+	// Curve options, forwarded to the weight tween
+	void setCurve(const animation::CubicBezier* curve) { m_tween.setCurve(curve); }
+	void useTable(bool b)                             { m_tween.useTable(b); }
+	void setPrecision(EasingPrecision precision)       { m_tween.setPrecision(precision); }
+};
+
+#endif
@@ -0,0 +1,75 @@
+#include "engine/angle_interpolate.hpp"
+#include "engine/easing.hpp"
+#include "engine/interpolate.hpp"
+#include "engine/simd.hpp"
+
+#include <algorithm>
+
+namespace animation {
+
+namespace {
+
+	const std::size_t BLOCK_SIZE = 256;
+
+	template<class V>
+	V wrapLanes(V degrees) {
+		const V turn = simd::broadcast(360.f, V());
+		V r = degrees - turn * simd::floor(degrees * simd::broadcast(1.f / 360.f, V()));
+
+		// Rounding can land a tiny negative angle exactly on 360
+		return simd::select(r >= turn, r - turn, r);
+	}
+
+	template<class V>
+	V arcLanes(V from, V to) {
+		V d = to - from;
+		return d - simd::broadcast(360.f, V()) * simd::floor(d * simd::broadcast(1.f / 360.f, V()) + simd::broadcast(0.5f, V()));
+	}
+
+	template<class V>
+	V rotationLanes(V w, V from, V to) {
+		return wrapLanes(from + arcLanes(from, to) * w);
+	}
+}
+
+float AngleInterpolate::wrap(float degrees) {
+	return wrapLanes(simd::f32x1 { degrees }).v;
+}
+
+float AngleInterpolate::shortestArc(float from, float to) {
+	return arcLanes(simd::f32x1 { from }, simd::f32x1 { to }).v;
+}
+
+float AngleInterpolate::lerp(float from, float to, float w) {
+	return rotationLanes(simd::f32x1 { w }, simd::f32x1 { from }, simd::f32x1 { to }).v;
+}
+
+float AngleInterpolate::interpolate(InterpFunc func, float from, float to, float t) {
+	return lerp(from, to, easing::evaluate(func, t));
+}
+
+void AngleInterpolate::evaluate(InterpFunc func, const float* t, const float* from, const float* to,
+								float* out, std::size_t count) {
+	typedef simd::native V;
+	float weights[BLOCK_SIZE];
+
+	for (std::size_t block = 0; block < count; block += BLOCK_SIZE) {
+		std::size_t n = std::min(BLOCK_SIZE, count - block);
+		Interpolate::evaluate(func, t + block, weights, n);
+
+		const float* f = from + block;
+		const float* g = to + block;
+		float* o = out + block;
+		std::size_t i = 0;
+
+		for (; i + V::width <= n; i += V::width) {
+			V w = simd::load(weights + i, V());
+			simd::store(o + i, rotationLanes(w, simd::load(f + i, V()), simd::load(g + i, V())));
+		}
+
+		for (; i < n; ++i)
+			o[i] = lerp(f[i], g[i], weights[i]);
+	}
+}
+
+}
@@ -1,14 +1,16 @@
 #include "engine/camera.hpp"
-#include "engine/utils.hpp"
+#include "engine/spring.hpp"
 
 using namespace sf;
 
 /** Initialises a camera with default values.
 *
 * Disables clamping to the background size and provides
-* default interpolation and duration values for the tweens.
+* default interpolation and duration values for the tweens,
+* which are created in the tweens pool.
 */
-Camera::Camera() {
+Camera::Camera(TweenPool<ValueTween<Vector2f>>& tweens)
+		: m_tweens(&tweens) {
 	initDefault();
 }
 
@@ -18,29 +20,28 @@ Camera::Camera() {
 * position to the background container. Default interpolation
 * and duration values are initialised.
 */
-Camera::Camera(const Vector2f& position,
+Camera::Camera(TweenPool<ValueTween<Vector2f>>& tweens,
+			   const Vector2f& position,
 			   const Vector2u& backgroundSize,
 			   const Vector2f& resolution,
 			   bool clamp=true)
 			   	: m_position(position)
 				, m_backgroundSize(backgroundSize)
 				, m_clampToBackground(clamp)
-				, m_tweenX(nullptr)
-				, m_tweenY(nullptr) {
+				, m_spring(nullptr)
+				, m_tweens(&tweens) {
 
 	calculateMinMaxPos(backgroundSize, resolution);
 
 	m_interpolation = InterpFunc::QuartEaseOut;
 	m_duration = 1.f;
-	m_tweenXActive = false;
-	m_tweenYActive = false;
 }
 
-/** Deallocates camera's tween objects.
+/** Releases the camera's tween back to the pool.
 */
 Camera::~Camera() {
-	SafeDelete(m_tweenX);
-	SafeDelete(m_tweenY);
+	// A stale handle, e.g. a finished tween, is ignored
+	m_tweens->stop(m_tween);
 }
 
 void Camera::initDefault() {
@@ -57,10 +58,8 @@ void Camera::initDefault() {
 
 	m_interpolation = InterpFunc::QuartEaseOut;
 	m_duration = 1.f;
-	m_tweenX = nullptr;
-	m_tweenY = nullptr;
-	m_tweenXActive = false;
-	m_tweenYActive = false;
+	m_spring = nullptr;
+	m_tween = TweenHandle();
 }
 
 void Camera::clampPosition(const Vector2f& pos) {
@@ -91,30 +90,29 @@ void Camera::calculateMinMaxPos(const sf::Vector2u& backgroundSize,
 
 void Camera::animateTo(const Vector2f& target) {
 
-	// Animate only if there isn't an animation already playing
-	if (m_tweenXActive || m_tweenYActive)
-		return;
+	// A new target mid-flight replaces the running tween with one that
+	// starts where the camera is now, so the view never jumps
+	m_tweens->stop(m_tween);
 
-	spawnTweenX(target.x);
-	spawnTweenY(target.y);
+	spawnTween(target);
 }
 
-void Camera::spawnTweenX(float targetX) {
-	if (targetX < m_minX) targetX = m_minX;
-	if (targetX > m_maxX) targetX = m_maxX;
+void Camera::spawnTween(const Vector2f& target) {
+	Vector2f clamped = target;
+	if (clamped.x < m_minX) clamped.x = m_minX;
+	if (clamped.x > m_maxX) clamped.x = m_maxX;
+	if (clamped.y < m_minY) clamped.y = m_minY;
+	if (clamped.y > m_maxY) clamped.y = m_maxY;
 
-	m_tweenX = new Tween(&m_position.x, m_position.x, targetX, m_duration, m_interpolation);
-	m_tweenX->start();
-	m_tweenXActive = true;
-}
-
-void Camera::spawnTweenY(float targetY) {
-	if (targetY < m_minY) targetY = m_minY;
-	if (targetY > m_maxY) targetY = m_maxY;
+	// One tween eases both axes with a single curve evaluation
+	if (m_spring)
+		m_tween = m_tweens->create(&m_position, m_position, clamped, *m_spring);
+	else
+		m_tween = m_tweens->create(&m_position, m_position, clamped, m_duration, m_interpolation);
 
-	m_tweenY = new Tween(&m_position.y, m_position.y, targetY, m_duration, m_interpolation);
-	m_tweenY->start();
-	m_tweenYActive = true;
+	// A full Fixed pool gives a null handle; the camera keeps following
+	if (ValueTween<Vector2f>* tween = m_tweens->get(m_tween))
+		tween->start();
 }
 
 void Camera::clampTo(const sf::Vector2u& backgroundSize,
@@ -142,10 +140,22 @@ InterpFunc Camera::getInterpolation() const {
 	return m_interpolation;
 }
 
+void Camera::setSpring(const animation::Spring* spring) {
+	m_spring = spring;
+}
+
 Vector2f Camera::getPosition() const {
 	return m_position;
 }
 
+Vector2f Camera::getVelocity() const {
+	const ValueTween<Vector2f>* tween = m_tweens->get(m_tween);
+	if (tween == nullptr)
+		return Vector2f(0.f, 0.f);
+
+	return (tween->getTargetValue() - tween->getStartValue()) * tween->getWeightVelocity();
+}
+
 void Camera::setPosition(const Vector2f& pos) {
 	if (m_clampToBackground) {
 		clampPosition(pos);
@@ -168,31 +178,16 @@ void Camera::setDuration(float duration) {
 // ----------------------------------------------------------------------
 
 bool Camera::isAnimating() const {
-	return (m_tweenXActive || m_tweenYActive);
+	// The pool releases the tween, and the handle goes stale, when it finishes
+	return m_tweens->isValid(m_tween);
 }
 
-void Camera::update(float dt, const Circle& player) {
-
-	// Deallocate tweens if it has finished animating, otherwise call update()
-	if (m_tweenXActive && (!m_tweenX->isAnimating())) {
-		m_tweenXActive = false;
-		SafeDelete(m_tweenX);
-	}
-	else if (m_tweenXActive) {
-		m_tweenX->update(dt);
-	}
-
-	if (m_tweenYActive && (!m_tweenY->isAnimating())) {
-		m_tweenYActive = false;
-		SafeDelete(m_tweenY);
-	}
-	else if (m_tweenYActive) {
-		m_tweenY->update(dt);
-	}
+void Camera::update(const Circle& player) {
+	bool animating = isAnimating();
 
 	// Camera position may be out of bounds of the background
 	if (m_clampToBackground) {
-		if (m_tweenXActive || m_tweenYActive) {
+		if (animating) {
 
 			float cameraX = 0.f;
             float cameraY = 0.f;
@@ -219,7 +214,7 @@ void Camera::update(float dt, const Circle& player) {
 	}
 
 	// Update camera position based on the player if it's not animating
-	if (!m_tweenXActive && !m_tweenYActive) {
+	if (!animating) {
 		float playerX = player.getCenter().x;
 		float playerY = player.getCenter().y;
 
@@ -1,5 +1,5 @@
-#include "engine/utils.hpp"
 #include "engine/circle.hpp"
+#include "engine/easing_inverse.hpp"
 
 /*------------------------------------------------------------
   Static member initialisation
@@ -28,8 +28,8 @@ Circle::Circle(const Vector2f& position,
 	   const float radius) {
 
 	m_active = false;
-	m_tweenA = nullptr;
-	m_tweenB = nullptr;
+	m_tweens = nullptr;
+	m_spawnTweens = nullptr;
 	m_position = position;
 
 	m_sprite.setPosition(position);
@@ -42,8 +42,13 @@ Circle::Circle(const Vector2f& position,
 }
 
 Circle::~Circle() {
-	SafeDelete(m_tweenA);
-	SafeDelete(m_tweenB);
+	// A stale handle, e.g. a finished tween, is ignored
+	if (m_tweens != nullptr) {
+		m_tweens->stop(m_demoTween);
+	}
+
+	// Spawn tweens write through &m_position.x, so they must not outlive it
+	stopSpawnedTweens();
 }
 
 /*------------------------------------------------------------
@@ -58,8 +63,8 @@ void Circle::initialise() {
 	m_sprite.setRadius(DEFAULT_RADIUS);
 
 	m_active = false;
-	m_tweenA = nullptr;
-	m_tweenB = nullptr;
+	m_tweens = nullptr;
+	m_spawnTweens = nullptr;
 	m_position = m_sprite.getPosition();
 
 	stopMovement();
@@ -124,65 +129,117 @@ bool Circle::isActive() const {
   Tween API
   ------------------------------------------------------------ */
 
-void Circle::createDemoTween(InterpFunc func) {
-	m_tweenA = new Tween(&m_position.x, 30.f, (800.f-130.f), 5.f);
+void Circle::createDemoTween(TweenPool<Tween>& tweens, InterpFunc func) {
+	m_tweens = &tweens;
+	m_demoTween = tweens.create(&m_position.x, 30.f, (800.f-130.f), 5.f);
+}
+
+Tween* Circle::demoTween() {
+	if (m_tweens == nullptr) {
+		return nullptr;
+	}
+
+	// The pool recycles a tween once it finishes; a fresh one replays
+	// from the start, as the finished tween would have
+	if (!m_tweens->isValid(m_demoTween)) {
+		m_demoTween = m_tweens->create(&m_position.x, 30.f, (800.f-130.f), 5.f);
+	}
+
+	return m_tweens->get(m_demoTween);
+}
+
+void Circle::stopSpawnedTweens() {
+	if (m_spawnTweens != nullptr) {
+		m_spawnTweens->stop(&m_position.x);
+	}
 }
 
 // Starts or stops the tween by inverting its animation flag
 void Circle::startStopTweenToggle() {
-	if (!m_tweenA->isAnimating()) {
-		m_tweenA->start();
+	Tween* tween = demoTween();
+	if (tween == nullptr) {
+		return;
+	}
+
+	if (!tween->isAnimating()) {
+		stopSpawnedTweens();
+		tween->start();
 	}
 	else {
-		m_tweenA->stop();
+		tween->stop();
 	}
 }
 
 void Circle::startTween() {
-	m_tweenA->start();
+	if (Tween* tween = demoTween()) {
+		stopSpawnedTweens();
+		tween->start();
+	}
 }
 
 // Stops the tween at its current position
 void Circle::stopTween() {
-	m_tweenA->stop();
+	if (Tween* tween = demoTween()) {
+		tween->stop();
+	}
 }
 
 // Moves object to start position; pass bool for the animation flag
 // NOTE: Return pointer to tween for chaining calls
 void Circle::resetTween(bool start) {
-	start ? m_tweenA->resetAndPlay() : m_tweenA->resetAndStop();
+	if (Tween* tween = demoTween()) {
+		stopSpawnedTweens();
+		start ? tween->resetAndPlay() : tween->resetAndStop();
+	}
 }
 
 
-void Circle::spawnInTween() {
+// Animates property along the path from start to target, picking up at
+// the point of the curve where it already is: re-spawning mid-flight then
+// continues the motion instead of replaying the whole duration. A value
+// off the path starts a fresh tween from there.
+static void resumeTween(TweenManager& tweens, float* property, float start, float target,
+						float duration, const animation::InverseTable& inverse) {
+	float u = ((*property) - start) / (target - start);
+
+	if (u >= 0.f && u <= 1.f) {
+		tweens.add(property, start, target, duration, inverse.function(), duration * inverse.solve(u));
+	}
+	else {
+		tweens.add(property, *property, target, duration, inverse.function());
+	}
+}
+
+void Circle::spawnInTween(TweenManager& tweens) {
 
 	// We will animate the circle back to its original position.
-	// We shall delete the current tween if it exists because we don't
-	// want it  to interfere with our new tween.
+	// We stop the demo tween and any spawned tween because we don't
+	// want them to interfere with our new tween.
 
-	if (m_tweenA != nullptr) {
-		m_tweenA->stop();
-		SafeDelete(m_tweenA);
+	if (m_tweens != nullptr) {
+		if (Tween* tween = m_tweens->get(m_demoTween)) {
+			tween->stop();
+		}
 	}
+	m_spawnTweens = &tweens;
+	stopSpawnedTweens();
 
-	float target  = 30.0f;
-	float current = m_position.x;
-
-	m_tweenA = new Tween(&m_position.x, current, target, .5f, InterpFunc::QuintEaseOut);
-	m_tweenA->start();
+	// Built on first use and shared by every circle
+	static const animation::InverseTable inverse(InterpFunc::QuintEaseOut);
+	resumeTween(tweens, &m_position.x, 670.f, 30.f, .5f, inverse);
 }
 
-void Circle::spawnOutTween() {
-	if (m_tweenA != nullptr) {
-		m_tweenA->stop();
-		SafeDelete(m_tweenA);
+void Circle::spawnOutTween(TweenManager& tweens) {
+	if (m_tweens != nullptr) {
+		if (Tween* tween = m_tweens->get(m_demoTween)) {
+			tween->stop();
+		}
 	}
+	m_spawnTweens = &tweens;
+	stopSpawnedTweens();
 
-	float target = 670.f;
-	float current = m_position.x;
-
-	m_tweenA = new Tween(&m_position.x, current, target, 2.f, InterpFunc::BounceEaseOut);
-	m_tweenA->start();
+	static const animation::InverseTable inverse(InterpFunc::BounceEaseOut);
+	resumeTween(tweens, &m_position.x, 30.f, 670.f, 2.f, inverse);
 }
 
 /*------------------------------------------------------------
@@ -230,10 +287,6 @@ bool Circle::movingRight() const { return m_moveRight; };
   ------------------------------------------------------------ */
 
 void Circle::update(float dt) {
-	if (m_tweenA != nullptr) {
-		m_tweenA->update(dt); 			// update position
-	}
-
 	if (m_active) {
 		if (m_moveUp)    m_position.y -= MOVE_SPEED * dt;
 		if (m_moveDown)  m_position.y += MOVE_SPEED * dt;
@@ -0,0 +1,176 @@
+#include "engine/color_interpolate.hpp"
+#include "engine/easing.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace animation {
+
+namespace {
+
+	float decodeExact(double c) {
+		return static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+	}
+
+	// Linear intensity of every 8-bit sRGB channel value
+	const std::array<float, 256> DECODE = [] {
+		std::array<float, 256> table;
+		for (int i = 0; i < 256; ++i)
+			table[i] = decodeExact(i / 255.0);
+		return table;
+	}();
+
+	// THRESHOLD[i] is the linear value halfway between channels i and i + 1;
+	// the 256th entry only pads the table to a power of two
+	const std::array<float, 256> THRESHOLD = [] {
+		std::array<float, 256> table;
+		for (int i = 0; i < 255; ++i)
+			table[i] = decodeExact((i + 0.5) / 255.0);
+		table[255] = 2.f;
+		return table;
+	}();
+
+	float clamp01(float x) {
+		return x < 0.f ? 0.f : (x > 1.f ? 1.f : x);
+	}
+
+	float cbrtFast(float x) {
+		if (x <= 0.f)
+			return 0.f;
+
+		// Exponent divided by three for a first guess, then two Halley steps
+		std::uint32_t bits;
+		std::memcpy(&bits, &x, sizeof(bits));
+		bits = bits / 3 + 709921077u;
+
+		float y;
+		std::memcpy(&y, &bits, sizeof(y));
+
+		for (int i = 0; i < 2; ++i) {
+			float y3 = y * y * y;
+			y *= (y3 + 2.f * x) / (2.f * y3 + x);
+		}
+		return y;
+	}
+
+	// Linear sRGB to OKLab (Ottosson 2020)
+	ColorVector linearToOklab(float r, float g, float b, float alpha) {
+		float l = cbrtFast(0.4122214708f * r + 0.5363325363f * g + 0.0514459929f * b);
+		float m = cbrtFast(0.2119034982f * r + 0.6806995451f * g + 0.1073969566f * b);
+		float s = cbrtFast(0.0883024619f * r + 0.2817188376f * g + 0.6299787005f * b);
+
+		return ColorVector {
+			0.2104542553f * l + 0.7936177850f * m - 0.0040720468f * s,
+			1.9779984951f * l - 2.4285922050f * m + 0.4505937099f * s,
+			0.0259040371f * l + 0.7827717662f * m - 0.8086757660f * s,
+			alpha };
+	}
+
+	sf::Color oklabToColor(const ColorVector& c) {
+		float l = c.x + 0.3963377774f * c.y + 0.2158037573f * c.z;
+		float m = c.x - 0.1055613458f * c.y - 0.0638541728f * c.z;
+		float s = c.x - 0.0894841775f * c.y - 1.2914855480f * c.z;
+		l = l * l * l;
+		m = m * m * m;
+		s = s * s * s;
+
+		return sf::Color(
+			ColorInterpolate::toSRGB( 4.0767416621f * l - 3.3077115913f * m + 0.2309699292f * s),
+			ColorInterpolate::toSRGB(-1.2684380046f * l + 2.6097574011f * m - 0.3413193965f * s),
+			ColorInterpolate::toSRGB(-0.0041960863f * l - 0.7034186147f * m + 1.7076147010f * s),
+			static_cast<sf::Uint8>(clamp01(c.alpha) * 255.f + 0.5f));
+	}
+
+	ColorVector lerpVector(const ColorVector& a, const ColorVector& b, float w) {
+		return ColorVector {
+			a.x + (b.x - a.x) * w,
+			a.y + (b.y - a.y) * w,
+			a.z + (b.z - a.z) * w,
+			a.alpha + (b.alpha - a.alpha) * w };
+	}
+}
+
+float ColorInterpolate::toLinear(sf::Uint8 channel) {
+	return DECODE[channel];
+}
+
+sf::Uint8 ColorInterpolate::toSRGB(float linear) {
+	// Count the thresholds below the value; the select is a conditional move
+	const float* base = THRESHOLD.data();
+	for (std::size_t half = 128; half > 0; half /= 2)
+		base = base[half - 1] < linear ? base + half : base;
+
+	return static_cast<sf::Uint8>(base - THRESHOLD.data());
+}
+
+ColorVector ColorInterpolate::decode(const sf::Color& color, ColorSpace space) {
+	float alpha = color.a / 255.f;
+
+	switch (space) {
+	case ColorSpace::LinearRGB:
+		return ColorVector { DECODE[color.r], DECODE[color.g], DECODE[color.b], alpha };
+	case ColorSpace::OKLab:
+		return linearToOklab(DECODE[color.r], DECODE[color.g], DECODE[color.b], alpha);
+	default:
+		return ColorVector { color.r / 255.f, color.g / 255.f, color.b / 255.f, alpha };
+	}
+}
+
+sf::Color ColorInterpolate::encode(const ColorVector& color, ColorSpace space) {
+	auto channel = [](float x) { return static_cast<sf::Uint8>(clamp01(x) * 255.f + 0.5f); };
+
+	switch (space) {
+	case ColorSpace::LinearRGB:
+		return sf::Color(toSRGB(color.x), toSRGB(color.y), toSRGB(color.z), channel(color.alpha));
+	case ColorSpace::OKLab:
+		return oklabToColor(color);
+	default:
+		return sf::Color(channel(color.x), channel(color.y), channel(color.z), channel(color.alpha));
+	}
+}
+
+sf::Color ColorInterpolate::lerp(const sf::Color& a, const sf::Color& b, float w, ColorSpace space) {
+	return encode(lerpVector(decode(a, space), decode(b, space), w), space);
+}
+
+sf::Color ColorInterpolate::interpolate(InterpFunc func, const sf::Color& a, const sf::Color& b,
+										float t, ColorSpace space) {
+	return lerp(a, b, easing::evaluate(func, t), space);
+}
+
+void ColorInterpolate::decode(const sf::Color* colors, ColorVector* out, std::size_t count, ColorSpace space) {
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = decode(colors[i], space);
+}
+
+void ColorInterpolate::blendVertexColors(const ColorVector* from, const ColorVector* to, float weight,
+										 sf::Vertex* vertices, std::size_t count, ColorSpace space) {
+	// Resolve the space once so each loop body is straight-line code
+	switch (space) {
+	case ColorSpace::LinearRGB:
+		for (std::size_t i = 0; i < count; ++i)
+			vertices[i].color = encode(lerpVector(from[i], to[i], weight), ColorSpace::LinearRGB);
+		break;
+	case ColorSpace::OKLab:
+		for (std::size_t i = 0; i < count; ++i)
+			vertices[i].color = oklabToColor(lerpVector(from[i], to[i], weight));
+		break;
+	default:
+		for (std::size_t i = 0; i < count; ++i)
+			vertices[i].color = encode(lerpVector(from[i], to[i], weight), ColorSpace::SRGB);
+		break;
+	}
+}
+
+void ColorInterpolate::blendVertexColors(InterpFunc func, float t,
+										 const sf::Color* from, const sf::Color* to,
+										 sf::Vertex* vertices, std::size_t count, ColorSpace space) {
+	float weight = easing::evaluate(func, t);
+
+	for (std::size_t i = 0; i < count; ++i)
+		vertices[i].color = lerp(from[i], to[i], weight, space);
+}
+
+}
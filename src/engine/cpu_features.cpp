@@ -0,0 +1,147 @@
+#include "engine/cpu_features.hpp"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define ANIMATION_CPU_X86
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#elif defined(__arm__) && defined(__linux__)
+	#include <sys/auxv.h>
+#endif
+
+namespace animation {
+
+namespace {
+
+	// Bit i is set when InstructionSet(i) is supported
+	typedef std::uint32_t FeatureMask;
+
+	FeatureMask bit(InstructionSet isa) {
+		return FeatureMask(1) << static_cast<int>(isa);
+	}
+
+#if defined(ANIMATION_CPU_X86)
+	void cpuid(std::uint32_t leaf, std::uint32_t sub, std::uint32_t regs[4]) {
+	#if defined(_MSC_VER)
+		int r[4];
+		__cpuidex(r, static_cast<int>(leaf), static_cast<int>(sub));
+		for (int i = 0; i < 4; ++i)
+			regs[i] = static_cast<std::uint32_t>(r[i]);
+	#else
+		unsigned int a = 0, b = 0, c = 0, d = 0;
+		if (leaf <= __get_cpuid_max(0, nullptr))
+			__cpuid_count(leaf, sub, a, b, c, d);
+		regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+	#endif
+	}
+
+	// Register state the OS saves on a context switch (XCR0)
+	std::uint64_t xgetbv() {
+	#if defined(_MSC_VER)
+		return _xgetbv(0);
+	#else
+		std::uint32_t lo, hi;
+		__asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		return (static_cast<std::uint64_t>(hi) << 32) | lo;
+	#endif
+	}
+
+	FeatureMask detect() {
+		FeatureMask mask = bit(InstructionSet::Scalar);
+		std::uint32_t r[4];
+
+		cpuid(1, 0, r);
+		const bool sse2 = (r[3] >> 26) & 1;
+		const bool fma = (r[2] >> 12) & 1;
+		const bool osxsave = (r[2] >> 27) & 1;
+		const bool avx = (r[2] >> 28) & 1;
+
+		if (sse2)
+			mask |= bit(InstructionSet::SSE2);
+		if (!osxsave || !avx)
+			return mask;
+
+		// XMM and YMM state for AVX, plus opmask and both ZMM halves for AVX-512
+		const std::uint64_t xcr0 = xgetbv();
+		const bool ymmSaved = (xcr0 & 0x06) == 0x06;
+		const bool zmmSaved = (xcr0 & 0xe6) == 0xe6;
+
+		cpuid(7, 0, r);
+		const bool avx2 = (r[1] >> 5) & 1;
+		const bool avx512f = (r[1] >> 16) & 1;
+
+		if (ymmSaved && avx2 && fma)
+			mask |= bit(InstructionSet::AVX2);
+		if (zmmSaved && avx512f && avx2 && fma)
+			mask |= bit(InstructionSet::AVX512);
+
+		return mask;
+	}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	FeatureMask detect() {
+		return bit(InstructionSet::Scalar) | bit(InstructionSet::NEON);
+	}
+#elif defined(__arm__) && defined(__linux__)
+	FeatureMask detect() {
+		const unsigned long HWCAP_NEON_BIT = 1ul << 12;	// HWCAP_NEON in asm/hwcap.h
+		FeatureMask mask = bit(InstructionSet::Scalar);
+
+		if (getauxval(AT_HWCAP) & HWCAP_NEON_BIT)
+			mask |= bit(InstructionSet::NEON);
+		return mask;
+	}
+#else
+	FeatureMask detect() {
+		return bit(InstructionSet::Scalar);
+	}
+#endif
+
+	FeatureMask features() {
+		static const FeatureMask mask = detect();
+		return mask;
+	}
+}
+
+bool CpuFeatures::supports(InstructionSet isa) {
+	return (features() & bit(isa)) != 0;
+}
+
+const char* CpuFeatures::name(InstructionSet isa) {
+	switch (isa) {
+	case InstructionSet::SSE2:   return "SSE2";
+	case InstructionSet::AVX2:   return "AVX2";
+	case InstructionSet::AVX512: return "AVX512";
+	case InstructionSet::NEON:   return "NEON";
+	default:                     return "Scalar";
+	}
+}
+
+std::string CpuFeatures::describe() {
+#if defined(__x86_64__) || defined(_M_X64)
+	std::string text = "x86-64:";
+#elif defined(ANIMATION_CPU_X86)
+	std::string text = "x86:";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	std::string text = "AArch64:";
+#elif defined(__arm__)
+	std::string text = "ARM:";
+#else
+	std::string text = "generic:";
+#endif
+
+	const InstructionSet all[] = {
+		InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512, InstructionSet::NEON
+	};
+
+	for (InstructionSet isa : all) {
+		if (supports(isa))
+			text += std::string(" ") + name(isa);
+	}
+	return text;
+}
+
+}
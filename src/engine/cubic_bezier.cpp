@@ -0,0 +1,162 @@
+#include "engine/cubic_bezier.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace animation {
+
+const int   CubicBezier::NEWTON_ITERATIONS = 8;
+const float CubicBezier::NEWTON_MIN_SLOPE = 0.001f;
+const float CubicBezier::SUBDIVISION_PRECISION = 1e-7f;
+const int   CubicBezier::SUBDIVISION_MAX_ITERATIONS = 10;
+
+const CubicBezier CubicBezier::Ease(0.25f, 0.1f, 0.25f, 1.f);
+const CubicBezier CubicBezier::EaseIn(0.42f, 0.f, 1.f, 1.f);
+const CubicBezier CubicBezier::EaseOut(0.f, 0.f, 0.58f, 1.f);
+const CubicBezier CubicBezier::EaseInOut(0.42f, 0.f, 0.58f, 1.f);
+
+namespace {
+
+	// One coordinate of the curve in power form: ((a * s + b) * s + c) * s
+	// for control values p1 and p2, with the end points fixed at 0 and 1
+	float coordA(float p1, float p2) { return 1.f - 3.f * p2 + 3.f * p1; }
+	float coordB(float p1, float p2) { return 3.f * p2 - 6.f * p1; }
+	float coordC(float p1)           { return 3.f * p1; }
+
+	float bezier(float s, float p1, float p2) {
+		return ((coordA(p1, p2) * s + coordB(p1, p2)) * s + coordC(p1)) * s;
+	}
+
+	// Derivative of bezier() with respect to the parameter s
+	float bezierSlope(float s, float p1, float p2) {
+		return 3.f * coordA(p1, p2) * s * s + 2.f * coordB(p1, p2) * s + coordC(p1);
+	}
+
+	float bezierCurvature(float s, float p1, float p2) {
+		return 6.f * coordA(p1, p2) * s + 2.f * coordB(p1, p2);
+	}
+}
+
+CubicBezier::CubicBezier(float x1, float y1, float x2, float y2)
+		: m_x1(std::min(std::max(x1, 0.f), 1.f))
+		, m_y1(y1)
+		, m_x2(std::min(std::max(x2, 0.f), 1.f))
+		, m_y2(y2) {
+
+	const float step = 1.f / static_cast<float>(SAMPLE_COUNT - 1);
+	for (int i = 0; i < SAMPLE_COUNT; ++i)
+		m_samples[i] = bezier(static_cast<float>(i) * step, m_x1, m_x2);
+}
+
+float CubicBezier::solveParameter(float x) const {
+	const float step = 1.f / static_cast<float>(SAMPLE_COUNT - 1);
+
+	// Sample interval holding x
+	int i = 1;
+	float start = 0.f;
+	for (; i < SAMPLE_COUNT - 1 && m_samples[i] <= x; ++i)
+		start += step;
+	--i;
+
+	// Initial guess from linear interpolation between the samples
+	float span = m_samples[i + 1] - m_samples[i];
+	float s = start + (span > 0.f ? (x - m_samples[i]) / span : 0.f) * step;
+	float slope = bezierSlope(s, m_x1, m_x2);
+
+	if (slope >= NEWTON_MIN_SLOPE) {
+		for (int n = 0; n < NEWTON_ITERATIONS; ++n) {
+			float error = bezier(s, m_x1, m_x2) - x;
+			slope = bezierSlope(s, m_x1, m_x2);
+			if (slope == 0.f || std::fabs(error) <= SUBDIVISION_PRECISION)
+				break;
+			s -= error / slope;
+		}
+		return s;
+	}
+
+	if (slope == 0.f)
+		return s;
+
+	// Too flat for Newton: bisect within the sample interval
+	float lo = start;
+	float hi = start + step;
+	for (int n = 0; n < SUBDIVISION_MAX_ITERATIONS; ++n) {
+		s = lo + (hi - lo) * 0.5f;
+		float error = bezier(s, m_x1, m_x2) - x;
+
+		if (std::fabs(error) <= SUBDIVISION_PRECISION)
+			break;
+		if (error > 0.f)
+			hi = s;
+		else
+			lo = s;
+	}
+
+	return s;
+}
+
+float CubicBezier::apply(float t) const {
+	if (t <= 0.f) return 0.f;
+	if (t >= 1.f) return 1.f;
+
+	// Control points on the diagonal give a straight line
+	if (m_x1 == m_y1 && m_x2 == m_y2)
+		return t;
+
+	return bezier(solveParameter(t), m_y1, m_y2);
+}
+
+float CubicBezier::apply(float t, float b, float c, float d) const {
+	return c * apply(t / d) + b;
+}
+
+float CubicBezier::velocity(float t) const {
+	t = std::min(std::max(t, 0.f), 1.f);
+	if (m_x1 == m_y1 && m_x2 == m_y2)
+		return 1.f;
+
+	// dy/dt = (dy/ds) / (dx/ds)
+	float s = solveParameter(t);
+	float dx = bezierSlope(s, m_x1, m_x2);
+	float dy = bezierSlope(s, m_y1, m_y2);
+	return dy / std::max(dx, 1e-6f);
+}
+
+float CubicBezier::acceleration(float t) const {
+	t = std::min(std::max(t, 0.f), 1.f);
+	if (m_x1 == m_y1 && m_x2 == m_y2)
+		return 0.f;
+
+	// d2y/dt2 = (y'' x' - y' x'') / x'^3, primes with respect to s
+	float s = solveParameter(t);
+	float dx = std::max(bezierSlope(s, m_x1, m_x2), 1e-6f);
+	float dy = bezierSlope(s, m_y1, m_y2);
+	float ddx = bezierCurvature(s, m_x1, m_x2);
+	float ddy = bezierCurvature(s, m_y1, m_y2);
+	return (ddy * dx - dy * ddx) / (dx * dx * dx);
+}
+
+float CubicBezier::inverse(float value) const {
+	if (value <= 0.f) return 0.f;
+	if (value >= 1.f) return 1.f;
+
+	// Bisect the parameter for y, then map it to time through x
+	float lo = 0.f;
+	float hi = 1.f;
+	for (int n = 0; n < 24; ++n) {
+		float s = 0.5f * (lo + hi);
+		if (bezier(s, m_y1, m_y2) < value)
+			lo = s;
+		else
+			hi = s;
+	}
+
+	return bezier(0.5f * (lo + hi), m_x1, m_x2);
+}
+
+void CubicBezier::evaluate(const float* t, float* out, std::size_t count) const {
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = apply(t[i]);
+}
+
+}
@@ -0,0 +1,279 @@
+#include "engine/easing_expression.hpp"
+#include "engine/interpolate.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace animation {
+
+const std::size_t CompiledEasing::BLOCK_SIZE = 256;
+
+struct EasingExpression::Node {
+	enum class Kind {
+		Curve, Time, Constant, Sequence, Blend, Reverse, Mirror, Scale, Clamp, Window, Remap
+	};
+
+	Kind kind;
+	InterpFunc func;
+	float p0;
+	float p1;
+	std::shared_ptr<const Node> a;
+	std::shared_ptr<const Node> b;
+	std::shared_ptr<const Node> c;
+};
+
+namespace {
+
+	typedef EasingExpression::Node Node;
+
+	std::shared_ptr<const Node> makeNode(Node::Kind kind, float p0 = 0.f, float p1 = 0.f,
+										 std::shared_ptr<const Node> a = nullptr,
+										 std::shared_ptr<const Node> b = nullptr,
+										 std::shared_ptr<const Node> c = nullptr) {
+		return std::make_shared<const Node>(Node {
+			kind, InterpFunc::Linear, p0, p1, std::move(a), std::move(b), std::move(c) });
+	}
+}
+
+// ----------------------------------------------------------------------
+// EasingExpression
+// ----------------------------------------------------------------------
+
+EasingExpression::EasingExpression(std::shared_ptr<const Node> node)
+		: m_node(std::move(node)) {
+}
+
+EasingExpression EasingExpression::curve(InterpFunc func) {
+	return EasingExpression(std::make_shared<const Node>(Node {
+		Node::Kind::Curve, func, 0.f, 0.f, nullptr, nullptr, nullptr }));
+}
+
+EasingExpression EasingExpression::time() {
+	return EasingExpression(makeNode(Node::Kind::Time));
+}
+
+EasingExpression EasingExpression::constant(float value) {
+	return EasingExpression(makeNode(Node::Kind::Constant, value));
+}
+
+EasingExpression EasingExpression::sequence(const EasingExpression& first,
+											const EasingExpression& second, float split) {
+	assert(split > 0.f && split < 1.f);
+	return EasingExpression(makeNode(Node::Kind::Sequence, split, 0.f, first.m_node, second.m_node));
+}
+
+EasingExpression EasingExpression::blend(const EasingExpression& a, const EasingExpression& b, float weight) {
+	return blend(a, b, constant(weight));
+}
+
+EasingExpression EasingExpression::blend(const EasingExpression& a, const EasingExpression& b,
+										 const EasingExpression& weight) {
+	return EasingExpression(makeNode(Node::Kind::Blend, 0.f, 0.f, a.m_node, b.m_node, weight.m_node));
+}
+
+EasingExpression EasingExpression::reverse() const {
+	return EasingExpression(makeNode(Node::Kind::Reverse, 0.f, 0.f, m_node));
+}
+
+EasingExpression EasingExpression::mirror() const {
+	return EasingExpression(makeNode(Node::Kind::Mirror, 0.f, 0.f, m_node));
+}
+
+EasingExpression EasingExpression::scale(float factor, float offset) const {
+	return EasingExpression(makeNode(Node::Kind::Scale, factor, offset, m_node));
+}
+
+EasingExpression EasingExpression::clamp(float low, float high) const {
+	assert(low <= high);
+	return EasingExpression(makeNode(Node::Kind::Clamp, low, high, m_node));
+}
+
+EasingExpression EasingExpression::remap(float start, float end) const {
+	assert(start < end);
+	return EasingExpression(makeNode(Node::Kind::Window, start, end, m_node));
+}
+
+EasingExpression EasingExpression::remap(const EasingExpression& time) const {
+	return EasingExpression(makeNode(Node::Kind::Remap, 0.f, 0.f, m_node, time.m_node));
+}
+
+const EasingExpression::Node& EasingExpression::root() const {
+	return *m_node;
+}
+
+// ----------------------------------------------------------------------
+// CompiledEasing
+// ----------------------------------------------------------------------
+
+namespace {
+
+	const float INF = std::numeric_limits<float>::infinity();
+
+	CompiledEasing::Op affine(std::uint16_t src, float scale, float offset,
+							  float low = -INF, float high = INF) {
+		return CompiledEasing::Op {
+			CompiledEasing::OpCode::Affine, InterpFunc::Linear, 0, src, 0, 0,
+			{ scale, offset, low, high } };
+	}
+
+	CompiledEasing::Op op(CompiledEasing::OpCode code, std::uint16_t a = 0,
+						  std::uint16_t b = 0, std::uint16_t c = 0, float p0 = 0.f) {
+		return CompiledEasing::Op { code, InterpFunc::Linear, 0, a, b, c, { p0, 0.f, 0.f, 0.f } };
+	}
+}
+
+CompiledEasing::CompiledEasing(const EasingExpression& expression)
+		: m_registers(1) {
+	// Register 0 is the input time
+	m_result = emit(expression.root(), 0);
+}
+
+std::uint16_t CompiledEasing::push(Op op) {
+	assert(m_registers < std::numeric_limits<std::uint16_t>::max());
+
+	op.dst = m_registers++;
+	m_ops.push_back(op);
+	return op.dst;
+}
+
+std::uint16_t CompiledEasing::emit(const EasingExpression::Node& node, std::uint16_t time) {
+	typedef EasingExpression::Node::Kind Kind;
+
+	switch (node.kind) {
+	case Kind::Curve: {
+		Op ease = op(OpCode::Ease, time);
+		ease.func = node.func;
+		return push(ease);
+	}
+
+	case Kind::Time:
+		return time;
+
+	case Kind::Constant:
+		return push(op(OpCode::Constant, 0, 0, 0, node.p0));
+
+	case Kind::Sequence: {
+		float split = node.p0;
+		std::uint16_t t0 = push(affine(time, 1.f / split, 0.f, 0.f, 1.f));
+		std::uint16_t t1 = push(affine(time, 1.f / (1.f - split), -split / (1.f - split), 0.f, 1.f));
+		std::uint16_t first = emit(*node.a, t0);
+		std::uint16_t second = emit(*node.b, t1);
+		return push(op(OpCode::Select, time, first, second, split));
+	}
+
+	case Kind::Blend: {
+		std::uint16_t a = emit(*node.a, time);
+		std::uint16_t b = emit(*node.b, time);
+		std::uint16_t w = emit(*node.c, time);
+		return push(op(OpCode::Lerp, a, b, w));
+	}
+
+	case Kind::Reverse:
+		return emit(*node.a, push(affine(time, -1.f, 1.f)));
+
+	case Kind::Mirror:
+		return emit(*node.a, push(op(OpCode::Mirror, time)));
+
+	case Kind::Scale:
+		return push(affine(emit(*node.a, time), node.p0, node.p1));
+
+	case Kind::Clamp:
+		return push(affine(emit(*node.a, time), 1.f, 0.f, node.p0, node.p1));
+
+	case Kind::Window: {
+		float span = node.p1 - node.p0;
+		return emit(*node.a, push(affine(time, 1.f / span, -node.p0 / span, 0.f, 1.f)));
+	}
+
+	case Kind::Remap:
+		return emit(*node.a, emit(*node.b, time));
+
+	default:
+		assert(false);
+		return time;
+	}
+}
+
+void CompiledEasing::run(const float* t, float* out, std::size_t count, float* scratch) const {
+	auto reg = [&](std::uint16_t r) -> float* {
+		return r == 0 ? const_cast<float*>(t) : scratch + (r - 1) * BLOCK_SIZE;
+	};
+
+	for (const Op& o : m_ops) {
+		float* dst = reg(o.dst);
+		const float* a = reg(o.a);
+		const float* b = reg(o.b);
+		const float* c = reg(o.c);
+
+		switch (o.code) {
+		case OpCode::Ease:
+			Interpolate::evaluate(o.func, a, dst, count);
+			break;
+
+		case OpCode::Constant:
+			std::fill(dst, dst + count, o.p[0]);
+			break;
+
+		case OpCode::Affine:
+			for (std::size_t i = 0; i < count; ++i)
+				dst[i] = std::min(std::max(o.p[0] * a[i] + o.p[1], o.p[2]), o.p[3]);
+			break;
+
+		case OpCode::Mirror:
+			for (std::size_t i = 0; i < count; ++i)
+				dst[i] = 1.f - std::fabs(1.f - 2.f * a[i]);
+			break;
+
+		case OpCode::Lerp:
+			for (std::size_t i = 0; i < count; ++i)
+				dst[i] = a[i] + (b[i] - a[i]) * c[i];
+			break;
+
+		case OpCode::Select:
+			for (std::size_t i = 0; i < count; ++i)
+				dst[i] = a[i] < o.p[0] ? b[i] : c[i];
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	std::copy(reg(m_result), reg(m_result) + count, out);
+}
+
+float CompiledEasing::apply(float t) const {
+	float out = 0.f;
+	evaluate(&t, &out, 1);
+	return out;
+}
+
+float CompiledEasing::apply(float t, float b, float c, float d) const {
+	return b + c * apply(t / d);
+}
+
+void CompiledEasing::evaluate(const float* t, float* out, std::size_t count) const {
+	// Scratch registers are per thread so a compiled curve can be shared
+	thread_local std::vector<float> scratch;
+
+	std::size_t size = static_cast<std::size_t>(m_registers - 1) * BLOCK_SIZE;
+	if (scratch.size() < size)
+		scratch.resize(size);
+
+	for (std::size_t i = 0; i < count; i += BLOCK_SIZE) {
+		std::size_t n = std::min(BLOCK_SIZE, count - i);
+		run(t + i, out + i, n, scratch.data());
+	}
+}
+
+const std::vector<CompiledEasing::Op>& CompiledEasing::ops() const {
+	return m_ops;
+}
+
+std::size_t CompiledEasing::registerCount() const {
+	return m_registers;
+}
+
+}
@@ -0,0 +1,275 @@
+#include "engine/easing_inverse.hpp"
+#include "engine/easing.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace animation {
+
+const int EasingInverse::MAX_ITERATIONS = 32;
+const int EasingInverse::SCAN_STEPS = 64;
+const float EasingInverse::TOLERANCE = 1e-6f;
+
+const std::size_t InverseTable::DEFAULT_RESOLUTION = 256;
+const int InverseTable::REFINE_ITERATIONS = 8;
+
+namespace {
+
+	float clamp01(float x) {
+		return std::min(std::max(x, 0.f), 1.f);
+	}
+
+	// Inverse of the In, Out and InOut polynomial curves of degree n
+	float polyIn(float v, float n)  { return std::pow(v, 1.f / n); }
+	float polyOut(float v, float n) { return 1.f - std::pow(1.f - v, 1.f / n); }
+
+	float polyInOut(float v, float n) {
+		return v < 0.5f
+			? std::pow(2.f * v, 1.f / n) / 2.f
+			: 1.f - std::pow(2.f - 2.f * v, 1.f / n) / 2.f;
+	}
+
+	/** Bracketed Newton iteration for ease(t) = value on [lo, hi].
+
+	f(lo) and f(hi) should have opposite signs. Steps that leave the
+	bracket, or hit a flat spot, are replaced by bisection.
+	*/
+	float refine(InterpFunc func, float value, float lo, float hi, float t, int iterations) {
+		float flo = easing::evaluate(func, lo) - value;
+
+		for (int i = 0; i < iterations; ++i) {
+			float ft = easing::evaluate(func, t) - value;
+			if (std::fabs(ft) <= EasingInverse::TOLERANCE)
+				break;
+
+			if ((ft < 0.f) == (flo < 0.f)) {
+				lo = t;
+				flo = ft;
+			}
+			else {
+				hi = t;
+			}
+
+			float slope = easing::velocity(func, t);
+			float next = slope != 0.f ? t - ft / slope : lo;
+
+			t = (next > lo && next < hi) ? next : 0.5f * (lo + hi);
+		}
+
+		return t;
+	}
+
+	// Bisects [lo, hi] for the point where the velocity changes sign
+	float turningPoint(InterpFunc func, float lo, float hi, float vlo) {
+		for (int i = 0; i < EasingInverse::MAX_ITERATIONS; ++i) {
+			float mid = 0.5f * (lo + hi);
+			float v = easing::velocity(func, mid);
+
+			if ((v < 0.f) == (vlo < 0.f))
+				lo = mid;
+			else
+				hi = mid;
+		}
+
+		return 0.5f * (lo + hi);
+	}
+}
+
+bool EasingInverse::hasClosedForm(InterpFunc func) {
+	switch (func) {
+	case InterpFunc::BackEaseIn:
+	case InterpFunc::BackEaseOut:
+	case InterpFunc::BackEaseInOut:
+	case InterpFunc::ElasticEaseIn:
+	case InterpFunc::ElasticEaseOut:
+	case InterpFunc::ElasticEaseInOut:
+	case InterpFunc::BounceEaseIn:
+	case InterpFunc::BounceEaseOut:
+	case InterpFunc::BounceEaseInOut:
+		return false;
+	default:
+		return true;
+	}
+}
+
+float EasingInverse::solve(InterpFunc func, float value) {
+	if (!hasClosedForm(func))
+		return solve(func, value, 0.f, 1.f);
+
+	const float halfPi = easing::PI / 2.f;
+	float v = clamp01(value);
+
+	switch (func) {
+	case InterpFunc::Linear:         return v;
+	case InterpFunc::QuadEaseIn:     return polyIn(v, 2.f);
+	case InterpFunc::QuadEaseOut:    return polyOut(v, 2.f);
+	case InterpFunc::QuadEaseInOut:  return polyInOut(v, 2.f);
+	case InterpFunc::CubicEaseIn:    return polyIn(v, 3.f);
+	case InterpFunc::CubicEaseOut:   return polyOut(v, 3.f);
+	case InterpFunc::CubicEaseInOut: return polyInOut(v, 3.f);
+	case InterpFunc::QuartEaseIn:    return polyIn(v, 4.f);
+	case InterpFunc::QuartEaseOut:   return polyOut(v, 4.f);
+	case InterpFunc::QuartEaseInOut: return polyInOut(v, 4.f);
+	case InterpFunc::QuintEaseIn:    return polyIn(v, 5.f);
+	case InterpFunc::QuintEaseOut:   return polyOut(v, 5.f);
+	case InterpFunc::QuintEaseInOut: return polyInOut(v, 5.f);
+
+	case InterpFunc::SineEaseIn:     return std::acos(1.f - v) / halfPi;
+	case InterpFunc::SineEaseOut:    return std::asin(v) / halfPi;
+	case InterpFunc::SineEaseInOut:  return std::acos(1.f - 2.f * v) / easing::PI;
+
+	case InterpFunc::ExpoEaseIn:
+		return v == 0.f ? 0.f : clamp01((std::log2(v) + 10.f) / 10.f);
+	case InterpFunc::ExpoEaseOut:
+		return v == 1.f ? 1.f : clamp01(-std::log2(1.f - v) / 10.f);
+	case InterpFunc::ExpoEaseInOut:
+		if (v == 0.f) return 0.f;
+		if (v == 1.f) return 1.f;
+		return clamp01(v < 0.5f
+			? (std::log2(2.f * v) + 10.f) / 20.f
+			: (10.f - std::log2(2.f - 2.f * v)) / 20.f);
+
+	case InterpFunc::CircEaseIn:
+		return std::sqrt(1.f - (1.f - v) * (1.f - v));
+	case InterpFunc::CircEaseOut:
+		return 1.f - std::sqrt(1.f - v * v);
+	case InterpFunc::CircEaseInOut: {
+		float w = 2.f * v - 1.f;
+		float r = std::sqrt(1.f - w * w) / 2.f;
+		return v < 0.5f ? r : 1.f - r;
+	}
+
+	default:
+		// Unknown values fall back to QuartEaseOut, as everywhere else
+		return polyOut(v, 4.f);
+	}
+}
+
+float EasingInverse::solve(InterpFunc func, float value, float b, float c, float d) {
+	if (c == 0.f)
+		return 0.f;
+
+	return d * solve(func, (value - b) / c);
+}
+
+float EasingInverse::solve(InterpFunc func, float value, float lo, float hi) {
+	assert(lo <= hi);
+
+	float prevT = lo;
+	float prevF = easing::evaluate(func, lo) - value;
+
+	if (prevF == 0.f)
+		return lo;
+
+	// Expo and elastic curves snap to 0 at t = 0; scan the smooth curve
+	// from just after the jump so values inside it are not skipped
+	prevT = std::nextafter(lo, hi);
+	prevF = easing::evaluate(func, prevT) - value;
+
+	float prevV = easing::velocity(func, prevT);
+	float bestT = lo;
+	float bestF = std::fabs(prevF);
+	float step = (hi - lo) / static_cast<float>(SCAN_STEPS);
+
+	// Find the first interval where ease(t) - value changes sign
+	for (int i = 1; i <= SCAN_STEPS; ++i) {
+		float t = i == SCAN_STEPS ? hi : lo + step * static_cast<float>(i);
+		float f = easing::evaluate(func, t) - value;
+		float v = easing::velocity(func, t);
+
+		if ((f <= 0.f) != (prevF <= 0.f) || f == 0.f) {
+			// Start from the secant estimate inside the bracket
+			float guess = prevT + (t - prevT) * prevF / (prevF - f);
+			return refine(func, value, prevT, t, guess, MAX_ITERATIONS);
+		}
+
+		// A peak between two samples can still cross the value
+		if ((v < 0.f) != (prevV < 0.f)) {
+			float peak = turningPoint(func, prevT, t, prevV);
+			float fp = easing::evaluate(func, peak) - value;
+
+			if ((fp <= 0.f) != (prevF <= 0.f))
+				return refine(func, value, prevT, peak, 0.5f * (prevT + peak), MAX_ITERATIONS);
+
+			if (std::fabs(fp) < bestF) {
+				bestT = peak;
+				bestF = std::fabs(fp);
+			}
+		}
+
+		if (std::fabs(f) < bestF) {
+			bestT = t;
+			bestF = std::fabs(f);
+		}
+
+		prevT = t;
+		prevF = f;
+		prevV = v;
+	}
+
+	// The value is never reached inside the bracket
+	return bestT;
+}
+
+// ----------------------------------------------------------------------
+// InverseTable
+// ----------------------------------------------------------------------
+
+InverseTable::InverseTable(InterpFunc func, std::size_t resolution)
+		: m_samples(resolution + 1)
+		, m_function(func)
+		, m_scale(static_cast<float>(resolution)) {
+	assert(resolution >= 2);
+
+	float low = 0.f;
+	float high = 0.f;
+
+	for (std::size_t i = 0; i <= resolution; ++i) {
+		float value = easing::evaluate(func, static_cast<float>(i) / m_scale);
+
+		low = i == 0 ? value : std::min(low, value);
+		high = i == 0 ? value : std::max(high, value);
+		m_samples[i] = Sample { value, low, high };
+	}
+}
+
+InterpFunc InverseTable::function() const {
+	return m_function;
+}
+
+std::size_t InverseTable::resolution() const {
+	return m_samples.size() - 1;
+}
+
+float InverseTable::solve(float value) const {
+	const std::size_t last = m_samples.size() - 1;
+
+	// Values never reached map to the first sample closest to them
+	value = std::min(std::max(value, m_samples[last].low), m_samples[last].high);
+
+	if (value == m_samples[0].value)
+		return 0.f;
+
+	// The running range only grows, so binary search for the first sample
+	// whose range holds the value; the crossing lies just before it
+	std::size_t lo = 1;
+	std::size_t hi = last;
+	while (lo < hi) {
+		std::size_t mid = (lo + hi) / 2;
+		if (value >= m_samples[mid].low && value <= m_samples[mid].high)
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+
+	const Sample& a = m_samples[lo - 1];
+	const Sample& b = m_samples[lo];
+	float t0 = static_cast<float>(lo - 1) / m_scale;
+	float t1 = static_cast<float>(lo) / m_scale;
+	float u = b.value != a.value ? (value - a.value) / (b.value - a.value) : 0.5f;
+
+	return refine(m_function, value, t0, t1, t0 + (t1 - t0) * clamp01(u), REFINE_ITERATIONS);
+}
+
+}
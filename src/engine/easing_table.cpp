@@ -0,0 +1,120 @@
+#include "engine/easing_table.hpp"
+#include "engine/easing.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace animation {
+
+const std::size_t EasingTable::DEFAULT_RESOLUTION = 256;
+
+std::vector<EasingTable::Sample> EasingTable::s_samples;
+std::vector<float> EasingTable::s_maxError;
+std::size_t EasingTable::s_resolution = 0;
+float EasingTable::s_scale = 0.f;
+TableFilter EasingTable::s_filter = TableFilter::Hermite;
+
+void EasingTable::build(std::size_t resolution, TableFilter filter) {
+	assert(resolution >= 2);
+
+	const std::size_t stride = resolution + 1;
+	s_samples.assign(stride * INTERP_FUNC_COUNT, Sample { 0.f, 0.f });
+	s_maxError.assign(INTERP_FUNC_COUNT, 0.f);
+	s_resolution = resolution;
+	s_scale = static_cast<float>(resolution);
+	s_filter = filter;
+
+	for (int f = 0; f < INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f + 1);
+		Sample* row = &s_samples[f * stride];
+
+		for (std::size_t i = 0; i <= resolution; ++i) {
+			float t = static_cast<float>(i) / s_scale;
+			row[i].value = easing::evaluate(func, t);
+		}
+
+		// Slopes from neighbouring samples (Catmull-Rom), one sided at the ends
+		row[0].slope = (-3.f * row[0].value + 4.f * row[1].value - row[2].value) * 0.5f;
+		row[resolution].slope = (3.f * row[resolution].value - 4.f * row[resolution - 1].value
+			+ row[resolution - 2].value) * 0.5f;
+
+		for (std::size_t i = 1; i < resolution; ++i) {
+			row[i].slope = (row[i + 1].value - row[i - 1].value) * 0.5f;
+		}
+	}
+
+	// Measure the reconstruction error on a 16x oversampled sweep
+	const std::size_t probes = resolution * 16;
+	for (int f = 0; f < INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f + 1);
+		float worst = 0.f;
+
+		for (std::size_t i = 0; i <= probes; ++i) {
+			float t = static_cast<float>(i) / static_cast<float>(probes);
+			worst = std::max(worst, std::fabs(evaluate(func, t) - easing::evaluate(func, t)));
+		}
+
+		s_maxError[f] = worst;
+	}
+}
+
+bool EasingTable::isBuilt() {
+	return s_resolution != 0;
+}
+
+std::size_t EasingTable::resolution() {
+	return s_resolution;
+}
+
+TableFilter EasingTable::filter() {
+	return s_filter;
+}
+
+float EasingTable::evaluate(InterpFunc func, float t) {
+	assert(isBuilt());
+
+	int f = static_cast<int>(func) - 1;
+	if (f < 0 || f >= INTERP_FUNC_COUNT)
+		f = static_cast<int>(InterpFunc::QuartEaseOut) - 1;
+
+	t = std::min(std::max(t, 0.f), 1.f);
+
+	float x = t * s_scale;
+	std::size_t i = std::min(static_cast<std::size_t>(x), s_resolution - 1);
+	float u = x - static_cast<float>(i);
+
+	const Sample* s = &s_samples[f * (s_resolution + 1) + i];
+
+	if (s_filter == TableFilter::Linear)
+		return s[0].value + (s[1].value - s[0].value) * u;
+
+	// Cubic Hermite basis
+	float u2 = u * u;
+	float u3 = u2 * u;
+	float h01 = 3.f * u2 - 2.f * u3;
+	float h10 = u3 - 2.f * u2 + u;
+	float h11 = u3 - u2;
+
+	return s[0].value + (s[1].value - s[0].value) * h01 + s[0].slope * h10 + s[1].slope * h11;
+}
+
+float EasingTable::evaluate(InterpFunc func, float t, float b, float c, float d) {
+	return c * evaluate(func, t / d) + b;
+}
+
+float EasingTable::maxError(InterpFunc func) {
+	int f = static_cast<int>(func) - 1;
+	if (f < 0 || f >= INTERP_FUNC_COUNT || s_maxError.empty())
+		return 0.f;
+	return s_maxError[f];
+}
+
+float EasingTable::maxError() {
+	float worst = 0.f;
+	for (float e : s_maxError)
+		worst = std::max(worst, e);
+	return worst;
+}
+
+}
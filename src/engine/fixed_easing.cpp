@@ -0,0 +1,42 @@
+#include "engine/fixed_easing.hpp"
+
+#include <cassert>
+
+namespace animation {
+namespace fixedpoint {
+
+q16 evaluate(InterpFunc func, q16 t) {
+	q16 result = 0;
+	dispatch(func, [&](auto curve) { result = decltype(curve)::apply(clamp01(t)); });
+	return result;
+}
+
+q16 evaluate(InterpFunc func, q16 t, q16 b, q16 c, q16 d) {
+	assert(d > 0);
+
+	q16 result = 0;
+	dispatch(func, [&](auto curve) {
+		result = b + mul(c, decltype(curve)::apply(clamp01(div(t, d))));
+	});
+	return result;
+}
+
+void evaluate(InterpFunc func, const q16* t, q16* out, std::size_t count) {
+	dispatch(func, [&](auto curve) {
+		for (std::size_t i = 0; i < count; ++i)
+			out[i] = decltype(curve)::apply(clamp01(t[i]));
+	});
+}
+
+void evaluate(InterpFunc func, const q16* t, const q16* b, const q16* c, q16 d,
+		q16* out, std::size_t count) {
+	assert(d > 0);
+
+	dispatch(func, [&](auto curve) {
+		for (std::size_t i = 0; i < count; ++i)
+			out[i] = b[i] + mul(c[i], decltype(curve)::apply(clamp01(div(t[i], d))));
+	});
+}
+
+}
+}
@@ -1,461 +1,306 @@
 #include "engine/interpolate.hpp"
+#include "engine/easing.hpp"
 
 namespace animation {
 
-const float Interpolate::fPI = static_cast<float>(M_PI);
+// Every function forwards to the header-only functors in engine/easing.hpp
 
+const float Interpolate::fPI = easing::PI;
+
+// linear - no easing, no acceleration
 float Interpolate::linear(float t, float b, float c, float d) {
-	return c * t/d + b;
+	return easing::Linear::apply(t, b, c, d);
 }
 
 // quadratic easing in - accelerating from zero velocity
 float Interpolate::easeInQuad(float t, float b, float c, float d) {
-	t /= d;
-	return c*t*t + b;
+	return easing::QuadEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInQuad(float t) {
-	return t*t;
+	return easing::QuadEaseIn::apply(t);
 }
 
 // quadratic easing out - decelerating to zero velocity
 float Interpolate::easeOutQuad(float t, float b, float c, float d) {
-	t /= d;
-	return -c * t*(t-2.f) + b;
+	return easing::QuadEaseOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeOutQuad(float t) {
-	return 1.f - (1.f - t) * (1.f - t);
+	return easing::QuadEaseOut::apply(t);
 }
 
 // quadratic easing in/out - acceleration until halfway, then deceleration
 float Interpolate::easeInOutQuad(float t, float b, float c, float d) {
-	t /= d/2.f;
-	if (t < 1.f)
-		return c/2.f*t*t + b;
-	t--;
-	return -c/2.f * (t*(t-2.f) - 1.f) + b;
+	return easing::QuadEaseInOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeInOutQuad(float t) {
-	return t < 0.5f ?
-		2.f * t * t :
-		1.f - pow(-2.f * t + 2.f, 2.f) / 2.f;
+	return easing::QuadEaseInOut::apply(t);
 }
 
 // cubic easing in - accelerating from zero velocity
 float Interpolate::easeInCubic(float t, float b, float c, float d) {
-	t /= d;
-	return c*t*t*t + b;
+	return easing::CubicEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInCubic(float t) {
-	return t * t * t;
+	return easing::CubicEaseIn::apply(t);
 }
 
 // cubic easing out - decelerating to zero velocity
 float Interpolate::easeOutCubic(float t, float b, float c, float d) {
-	t /= d;
-	t--;
-	return c*(t*t*t + 1.f) + b;
+	return easing::CubicEaseOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeOutCubic(float t) {
-	return 1.f - std::powf(1.f - t, 3);
+	return easing::CubicEaseOut::apply(t);
 }
 
 // cubic easing in/out - acceleration until halfway, then deceleration
 float Interpolate::easeInOutCubic(float t, float b, float c, float d) {
-	t /= d/2.f;
-	if (t < 1.f)
-		return c/2.f*t*t*t + b;
-	t -= 2.f;
-	return c/2*(t*t*t + 2.f) + b;
+	return easing::CubicEaseInOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeInOutCubic(float t) {
-	return t < 0.5f ?
-		4.f * t * t * t :
-		1.f - std::powf(-2.f * t + 2.f, 3.f) / 2.f;
+	return easing::CubicEaseInOut::apply(t);
 }
 
 // quartic easing in - accelerating from zero velocity
 float Interpolate::easeInQuart(float t, float b, float c, float d) {
-	t /= d;
-	return c*t*t*t*t + b;
+	return easing::QuartEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInQuart(float t) {
-	return t * t * t * t;
+	return easing::QuartEaseIn::apply(t);
 }
 
 // quartic easing out - decelerating to zero velocity
 float Interpolate::easeOutQuart(float t, float b, float c, float d) {
-	t /= d;
-	t--;
-	return -c * (t*t*t*t - 1.f) + b;
+	return easing::QuartEaseOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeOutQuart(float t) {
-	return 1.f - std::powf(1 - t, 4.f);
+	return easing::QuartEaseOut::apply(t);
 }
 
 // quartic easing in/out - acceleration until halfway, then deceleration
 float Interpolate::easeInOutQuart(float t, float b, float c, float d) {
-	t /= d/2.f;
-	if (t < 1.f) return c/2.f*t*t*t*t + b;
-	t -= 2.f;
-	return -c/2.f * (t*t*t*t - 2.f) + b;
+	return easing::QuartEaseInOut::apply(t, b, c, d);
+}
+
+float Interpolate::easeInOutQuart(float t) {
+	return easing::QuartEaseInOut::apply(t);
 }
 
 float Interpolate::easeInOutQuard(float t) {
-	return t < 0.5f ?
-		8.f * t * t * t * t :
-		1.f - std::powf(-2.f * t + 2.f, 4.f) / 2.f;
+	return easing::QuartEaseInOut::apply(t);
 }
 
 // quintic easing in - accelerating from zero velocity
 float Interpolate::easeInQuint(float t, float b, float c, float d) {
-	t /= d;
-	return c*t*t*t*t*t + b;
+	return easing::QuintEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInQuint(float t) {
-	return t * t * t * t * t;
+	return easing::QuintEaseIn::apply(t);
 }
 
 // quintic easing out - decelerating to zero velocity
 float Interpolate::easeOutQuint(float t, float b, float c, float d) {
-	t /= d;
-	t--;
-	return c*(t*t*t*t*t + 1.f) + b;
+	return easing::QuintEaseOut::apply(t, b, c, d);
+}
+
+float Interpolate::easeOutQuint(float t) {
+	return easing::QuintEaseOut::apply(t);
 }
 
 float Interpolate::easeOutQuant(float t) {
-	return 1.f - std::powf(1.f - t, 5.f);
+	return easing::QuintEaseOut::apply(t);
 }
 
 // quintic easing in/out - acceleration until halfway, then deceleration
 float Interpolate::easeInOutQuint(float t, float b, float c, float d) {
-	t /= d/2.f;
-	if (t < 1.f)
-		return c/2*t*t*t*t*t + b;
-	t -= 2.f;
-	return c/2.f*(t*t*t*t*t + 2.f) + b;
+	return easing::QuintEaseInOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeInOutQuint(float t) {
-	return t < 0.5f ?
-		16.f * t * t * t * t * t :
-		1.f - std::pow(-2.f * t + 2.f, 5.f) / 2.f;
+	return easing::QuintEaseInOut::apply(t);
 }
 
 // sinusoidal easing in - accelerating from zero velocity
 float Interpolate::easeInSine(float t, float b, float c, float d) {
-	return -c * std::cos(t/d * (fPI/2.f)) + c + b;
+	return easing::SineEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInSine(float t) {
-	return 1.f - std::cosf((t * fPI) / 2.f);
+	return easing::SineEaseIn::apply(t);
 }
 
 // sinusoidal easing out - decelerating to zero velocity
 float Interpolate::easeOutSine(float t, float b, float c, float d) {
-	return c * std::sin(t/d * (fPI/2.f)) + b;
+	return easing::SineEaseOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeOutSine(float t) {
-	return std::sinf((t * fPI) / 2.f);
+	return easing::SineEaseOut::apply(t);
 }
 
 // sinusoidal easing in/out - accelerating until halfway, then decelerating
 float Interpolate::easeInOutSine(float t, float b, float c, float d) {
-	return -c/2.f * (std::cos(fPI*t/d) - 1.f) + b;
+	return easing::SineEaseInOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeInOutSine(float t) {
-	return -(std::cosf(fPI * t) - 1.f) / 2.f;
+	return easing::SineEaseInOut::apply(t);
 }
 
 // exponential easing in - accelerating from zero velocity
 float Interpolate::easeInExpo(float t, float b, float c, float d) {
-	return c * std::powf( 2.f, 10.f * (t/d - 1.f) ) + b;
+	return easing::ExpoEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInExpo(float t) {
-	return t == 0 ? 0 : std::powf(2.f, 10.f * t - 10.f);
+	return easing::ExpoEaseIn::apply(t);
 }
 
 // exponential easing out - decelerating to zero velocity
 float Interpolate::easeOutExpo(float t, float b, float c, float d) {
-	return c * ( -std::powf( 2.f, -10.f * t/d ) + 1.f ) + b;
+	return easing::ExpoEaseOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeOutExpo(float t) {
-	return t == 1.f ?
-		1.f :
-		1.f - std::powf(2.f, -10.f * t);
+	return easing::ExpoEaseOut::apply(t);
 }
 
 // exponential easing in/out - accelerating until halfway, then decelerating
 float Interpolate::easeInOutExpo(float t, float b, float c, float d) {
-	t /= d/2.f;
-	if (t < 1.f)
-		return c/2.f * std::powf( 2.f, 10.f * (t - 1.f) ) + b;
-	t--;
-	return c/2 * ( -std::powf( 2.f, -10.f * t) + 2.f ) + b;
+	return easing::ExpoEaseInOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeInOutExpo(float t) {
-	if (t == 0) {
-		return 0;
-	}
-	else {
-		if (t == 1) {
-			return 1;
-		} else {
-			if (t < 0.5f) {
-				return std::powf(2.f, 20.f * t - 10) / 2.f;
-			}
-			else {
-				return (2.f - std::powf(2.f, -20.f * t + 10.f)) / 2.f;
-			}
-		}
-	}
+	return easing::ExpoEaseInOut::apply(t);
 }
 
 // circular easing in - accelerating from zero velocity
 float Interpolate::easeInCirc(float t, float b, float c, float d) {
-	t /= d;
-	return -c * (std::sqrtf(1.f - t*t) - 1.f) + b;
+	return easing::CircEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInCirc(float t) {
-	return 1.f - std::sqrtf(1.f - std::powf(t, 2.f));
+	return easing::CircEaseIn::apply(t);
 }
 
 // circular easing out - decelerating to zero velocity
 float Interpolate::easeOutCirc(float t, float b, float c, float d) {
-	t /= d;
-	t--;
-	return c * std::sqrtf(1.f - t*t) + b;
+	return easing::CircEaseOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeOutCirc(float t) {
-	return std::sqrtf(1.f - std::powf(t - 1.f, 2.f));
+	return easing::CircEaseOut::apply(t);
 }
 
 // circular easing in/out - acceleration until halfway, then deceleration
 float Interpolate::easeInOutCirc(float t, float b, float c, float d) {
-	t /= d/2.f;
-	if (t < 1.f)
-		return -c/2.f * (std::sqrtf(1.f - t*t) - 1.f) + b;
-	t -= 2.f;
-	return c/2.f * (std::sqrtf(1.f - t*t) + 1.f) + b;
+	return easing::CircEaseInOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeInOutCirc(float t) {
-	return t < 0.5f
-		? (1.f - std::sqrtf(1.f - std::powf(2.f * t, 2.f))) / 2.f
-		: (std::sqrtf(1.f - std::powf(-2.f * t + 2.f, 2.f)) + 1.f) / 2.f;
+	return easing::CircEaseInOut::apply(t);
 }
 
 // ease in back - pulls back before easing in
 float Interpolate::easeInBack(float t, float b, float c, float d, float c1) {
-	// tweak x for a more dramatic pull back
-	t /= d; // 0-1 on curve
-	float c3 = c1 + 1.f;
-	float val = c3 * t * t * t - c1 * t * t; // modify t with ease in back formula
-	return (c * val) + b;
+	return c * easing::BackEaseIn::apply(t / d, c1) + b;
 }
 
 float Interpolate::easeInBack(float t, float c1) {
-	float c3 = c1 + 1.f;
-	return c3 * t * t * t - c1 * t * t;
+	return easing::BackEaseIn::apply(t, c1);
 }
 
 // ease out back - over throws before easing out
 float Interpolate::easeOutBack(float t, float b, float c, float d, float c1) {
-	// tweak c1 value for a more dramatic over throw
-	t /= d; // 0-1 on curve
-	float c3 = c1 + 1.f;
-	float val = 1.f + c3 * std::powf(t - 1.f, 3.f) + c1 * std::powf(t - 1.f, 2.f); // apply ease in back formula
-	return (c * val) + b;
+	return c * easing::BackEaseOut::apply(t / d, c1) + b;
 }
 
-float Interpolate::easeOutBack(float t, float c1=1.70158f) {
-	float c3 = c1 + 1;
-	return 1.f + c3 * std::powf(t - 1.f, 3.f) + c1 * std::powf(t - 1.f, 2.f);
+float Interpolate::easeOutBack(float t, float c1) {
+	return easing::BackEaseOut::apply(t, c1);
 }
 
 // ease in out back - pull back and over throw
 float Interpolate::easeInOutBack(float t, float b, float c, float d, float c1) {
-	// tweak c1 value for a more dramatic pull back and over throw
-	t /= d;
-	float c2 = c1 * 1.525f;
-
-	// apply pull back / over throw formula
-	float val = t < 0.5f
-		? (pow(2.f * t, 2.f) * ((c2 + 1.f) * 2.f * t - c2)) / 2.f
-		: (pow(2.f * t - 2.f, 2.f) * ((c2 + 1.f) * (t * 2.f - 2.f) + c2) + 2.f) / 2.f;
-
-	return (c * val) + b;
+	return c * easing::BackEaseInOut::apply(t / d, c1) + b;
 }
 
-float Interpolate::easeInOutBack(float t, float c1=1.70158) {
-	float c2 = c1 * 1.525;
-
-	return t < 0.5f
-		? (std::powf(2.f * t, 2.f) * ((c2 + 1.f) * 2.f * t - c2)) / 2.f
-		: (std::powf(2.f * t - 2.f, 2.f) * ((c2 + 1.f) * (t * 2.f - 2.f) + c2) + 2.f) / 2.f;
+float Interpolate::easeInOutBack(float t, float c1) {
+	return easing::BackEaseInOut::apply(t, c1);
 }
 
 // ease in elastic
 float Interpolate::easeInElastic(float t, float b, float c, float d) {
-	t /= d;
-	float x = 10.75f; // magic number
-	float c4 = (2.f * fPI) / 3.f;
-	float val = t == 0
-		? 0
-		: t == 1.f
-			? 1.f
-			: -std::powf(2.f, 10.f * t - 10.f) * std::sinf((t * 10.f - x) * c4);
-
-	return (c * val) + b;
+	return easing::ElasticEaseIn::apply(t, b, c, d);
 }
 
 float Interpolate::easeInElastic(float t) {
-	float c4 = (2.f * fPI) / 3.f;
-	float x = 10.75f; // magic number
-	return t == 0
-		? 0
-		: t == 1.f
-			? 1.f
-			: -std::powf(2.f, 10.f * t - 10.f) * std::sinf((t * 10.f - x) * c4);
+	return easing::ElasticEaseIn::apply(t);
 }
 
 // ease out elastic
 float Interpolate::easeOutElastic(float t, float b, float c, float d) {
-	t /= d;
-	float x = 0.75f; // magic number
-	float c4 = (2.f * fPI) / 3.f;
-	float val = t == 0
-		? 0
-		: t == 1.f
-			? 1.f
-			: std::powf(2.f, -10.f * t) * std::sinf((t * 10.f - x) * c4) + 1.f;
-
-	return (c * val) + b;
+	return easing::ElasticEaseOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeOutElastic(float t) {
-	float c4 = (2.f * fPI) / 3.f;
-	float x = 0.75f; // magic number
-
-	return t == 0
-		? 0
-		: t == 1.f
-			? 1.f
-			: std::powf(2.f, -10.f * t) * std::sinf((t * 10.f - x) * c4) + 1.f;
+	return easing::ElasticEaseOut::apply(t);
 }
 
 // ease in out elastic
 float Interpolate::easeInOutElastic(float t, float b, float c, float d) {
-	t /= d;
-	float x = 11.125f; // magic number
-	float c5 = (2.f * fPI) / 4.5f;
-	float val = t == 0
-		? 0
-		: t == 1.f
-			? 1.f
-			: t < 0.5f
-				? -(std::powf(2.f, 20.f * t - 10.f) * std::sinf((20.f * t - x) * c5)) / 2.f
-				: (std::powf(2.f, -20.f * t + 10.f) * std::sinf((20.f * t - x) * c5)) / 2.f + 1.f;
-
-	return (c * val) + b;
+	return easing::ElasticEaseInOut::apply(t, b, c, d);
 }
 
 float Interpolate::easeInOutElastic(float t) {
-	float x = 11.125f; // magic number
-	float c5 = (2.f * fPI) / 4.5f;
-
-	return t == 0
-		? 0
-		: t == 1.f
-			? 1.f
-			: t < 0.5f
-				? -(std::powf(2.f, 20.f * t - 10.f) * std::sinf((20.f * t - x) * c5)) / 2.f
-				: (std::powf(2.f, -20.f * t + 10.f) * std::sinf((20.f * t - x) * c5)) / 2.f + 1.f;
-
+	return easing::ElasticEaseInOut::apply(t);
 }
 
 // ease out bounce
 float Interpolate::easeOutBounce(float t, float b, float c, float d) {
-	t /= d;
-	float n1 = 7.5625f;
-	float d1 = 2.75f;
-	float val = 0.f;
-
-	if (t < 1.f / d1) {
-		val = n1 * t * t;
-	} else if (t < 2.f / d1) {
-		t -= (1.5f / d1);
-		val = n1 * t * t + 0.75f;;
-	} else if (t < 2.5f / d1) {
-		t -= (2.25f / d1);
-		val = n1 * t * t + 0.9375f;
-	} else {
-		t -= (2.625f / d1);
-		val = n1 * t * t + 0.984375f;
-	}
-
-	return (c * val) + b;
-}
-
-// ease out bounce - pass value between 0 and 1 (also utility for easeInBounce())
+	return easing::BounceEaseOut::apply(t, b, c, d);
+}
+
 float Interpolate::easeOutBounce(float t) {
-	float n1 = 7.5625f;
-	float d1 = 2.75f;
-	float val = 0.f;
-
-	if (t < 1.f / d1) {
-		val = n1 * t * t;
-	} else if (t < 2.f / d1) {
-		t -= (1.5f / d1);
-		val = n1 * t * t + 0.75f;;
-	} else if (t < 2.5f / d1) {
-		t -= (2.25f / d1);
-		val = n1 * t * t + 0.9375f;
-	} else {
-		t -= (2.625f / d1);
-		val = n1 * t * t + 0.984375f;
-	}
-
-	return val;
+	return easing::BounceEaseOut::apply(t);
 }
 
 // ease in bounce
 float Interpolate::easeInBounce(float t, float b, float c, float d) {
-	float x = t /= d;
-	float val = 1.f - easeOutBounce(1.f - x);
-
-	return (c * val) + b;
+	return easing::BounceEaseIn::apply(t, b, c, d);
 }
 
-// ease in bounce - pass value between 0 and 1 (utility for easeInOutBounce())
 float Interpolate::easeInBounce(float t) {
-	return 1.f - easeOutBounce(1.f - t);
+	return easing::BounceEaseIn::apply(t);
 }
 
 // ease in out bounce
 float Interpolate::easeInOutBounce(float t, float b, float c, float d) {
-	t /= d;
-	float val = t < 0.5f
-		? (1.f - easeOutBounce(1.f - 2.f * t)) / 2.f
-		: (1.f + easeOutBounce(2.f * t - 1.f)) / 2.f;
+	return easing::BounceEaseInOut::apply(t, b, c, d);
+}
 
-	return (c * val) + b;
+// rate of change of any curve - first and second derivative with respect to time
+float Interpolate::velocity(InterpFunc func, float t) {
+	return easing::velocity(func, t);
 }
 
+float Interpolate::velocity(InterpFunc func, float t, float b, float c, float d) {
+	return easing::velocity(func, t, b, c, d);
+}
+
+float Interpolate::acceleration(InterpFunc func, float t) {
+	return easing::acceleration(func, t);
+}
+
+float Interpolate::acceleration(InterpFunc func, float t, float b, float c, float d) {
+	return easing::acceleration(func, t, b, c, d);
+}
 
 }
\ No newline at end of file
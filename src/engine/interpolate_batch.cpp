@@ -0,0 +1,131 @@
+#include "engine/interpolate.hpp"
+#include "engine/batch_kernels.hpp"
+#include "engine/easing_kernels.hpp"
+
+#include <atomic>
+
+namespace animation {
+
+const float Interpolate::BATCH_TOLERANCE = 2e-6f;
+
+namespace kernels {
+
+namespace {
+
+	// Instruction set the project's compiler flags build this file for
+#if defined(ANIMATION_SIMD_AVX512)
+	constexpr InstructionSet BASELINE = InstructionSet::AVX512;
+#elif defined(ANIMATION_SIMD_AVX2)
+	constexpr InstructionSet BASELINE = InstructionSet::AVX2;
+#elif defined(ANIMATION_SIMD_SSE2)
+	constexpr InstructionSet BASELINE = InstructionSet::SSE2;
+#elif defined(ANIMATION_SIMD_NEON)
+	constexpr InstructionSet BASELINE = InstructionSet::NEON;
+#else
+	constexpr InstructionSet BASELINE = InstructionSet::Scalar;
+#endif
+}
+
+const BatchTable* baselineBatchTable() {
+	static constexpr BatchTable table = makeBatchTable<simd::native>(BASELINE, ANIMATION_SIMD_NAME);
+	return &table;
+}
+
+// One lane at a time; never picked automatically, kept for comparison
+const BatchTable* scalarBatchTable() {
+	static constexpr BatchTable table = makeBatchTable<simd::f32x1>(InstructionSet::Scalar, "Scalar");
+	return &table;
+}
+
+}
+
+namespace {
+
+	typedef const kernels::BatchTable* (*TableSource)();
+
+	// Widest first; the first one the CPU supports is used
+	const TableSource TABLES[] = {
+		&kernels::avx512BatchTable,
+		&kernels::avx2BatchTable,
+		&kernels::neonBatchTable,
+		&kernels::baselineBatchTable,
+		&kernels::scalarBatchTable
+	};
+
+	std::atomic<const kernels::BatchTable*> s_table { nullptr };
+
+	const kernels::BatchTable* findTable(InstructionSet isa) {
+		for (TableSource source : TABLES) {
+			const kernels::BatchTable* table = source();
+			if (table && table->isa == isa)
+				return table;
+		}
+		return nullptr;
+	}
+
+	const kernels::BatchTable& activeTable() {
+		const kernels::BatchTable* table = s_table.load(std::memory_order_acquire);
+
+		if (!table) {
+			for (TableSource source : TABLES) {
+				table = source();
+				if (table && CpuFeatures::supports(table->isa))
+					break;
+			}
+
+			// Every caller computes the same choice, so racing stores are harmless
+			s_table.store(table, std::memory_order_release);
+		}
+
+		return *table;
+	}
+}
+
+void Interpolate::evaluate(InterpFunc func,
+						   const float* t, const float* b, const float* c, const float* d,
+						   float* out, std::size_t count) {
+	activeTable().evaluate(func, t, b, c, d, out, count);
+}
+
+void Interpolate::evaluate(InterpFunc func, const float* t, float* out, std::size_t count) {
+	activeTable().evaluateNormalized(func, t, out, count);
+}
+
+void Interpolate::evaluateVelocity(InterpFunc func,
+								   const float* t, const float* b, const float* c, const float* d,
+								   float* out, std::size_t count) {
+	activeTable().velocity(func, t, b, c, d, out, count);
+}
+
+void Interpolate::evaluateVelocity(InterpFunc func, const float* t, float* out, std::size_t count) {
+	activeTable().velocityNormalized(func, t, out, count);
+}
+
+void Interpolate::evaluateAcceleration(InterpFunc func,
+									   const float* t, const float* b, const float* c, const float* d,
+									   float* out, std::size_t count) {
+	activeTable().acceleration(func, t, b, c, d, out, count);
+}
+
+void Interpolate::evaluateAcceleration(InterpFunc func, const float* t, float* out, std::size_t count) {
+	activeTable().accelerationNormalized(func, t, out, count);
+}
+
+const char* Interpolate::batchInstructionSet() {
+	return activeTable().name;
+}
+
+InstructionSet Interpolate::batchInstructionSetId() {
+	return activeTable().isa;
+}
+
+bool Interpolate::useInstructionSet(InstructionSet isa) {
+	const kernels::BatchTable* table = findTable(isa);
+	if (!table || !CpuFeatures::supports(isa))
+		return false;
+
+	s_table.store(table, std::memory_order_release);
+	return true;
+}
+
+}
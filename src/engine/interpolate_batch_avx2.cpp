@@ -0,0 +1,53 @@
+// The batch easing kernels built for AVX2 + FMA, picked at run time by
+// Interpolate when CpuFeatures reports AVX2 (see engine/batch_kernels.hpp).
+// Only the kernels are compiled for the wider target; the table accessor
+// below runs on any CPU.
+#include "engine/batch_kernels.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+	#include <immintrin.h>
+
+	#if defined(__clang__)
+		#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+	#else
+		#pragma GCC push_options
+		#pragma GCC target("avx2,fma")
+	#endif
+
+	#define ANIMATION_SIMD_AVX2
+	#include "engine/easing_kernels.hpp"
+
+	#if defined(__clang__)
+		#pragma clang attribute pop
+	#else
+		#pragma GCC pop_options
+	#endif
+
+namespace animation {
+namespace kernels {
+
+const BatchTable* avx2BatchTable() {
+	static constexpr BatchTable table = makeBatchTable<simd::native>(InstructionSet::AVX2, "AVX2");
+	return &table;
+}
+
+}
+}
+
+#else
+
+namespace animation {
+namespace kernels {
+
+const BatchTable* avx2BatchTable() {
+	return nullptr;
+}
+
+}
+}
+
+#endif
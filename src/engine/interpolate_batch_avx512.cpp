@@ -0,0 +1,53 @@
+// The batch easing kernels built for AVX-512F, picked at run time by
+// Interpolate when CpuFeatures reports AVX-512 (see engine/batch_kernels.hpp).
+// Only the kernels are compiled for the wider target; the table accessor
+// below runs on any CPU.
+#include "engine/batch_kernels.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+	#include <immintrin.h>
+
+	#if defined(__clang__)
+		#pragma clang attribute push (__attribute__((target("avx512f,avx2,fma"))), apply_to = function)
+	#else
+		#pragma GCC push_options
+		#pragma GCC target("avx512f,avx2,fma")
+	#endif
+
+	#define ANIMATION_SIMD_AVX512
+	#include "engine/easing_kernels.hpp"
+
+	#if defined(__clang__)
+		#pragma clang attribute pop
+	#else
+		#pragma GCC pop_options
+	#endif
+
+namespace animation {
+namespace kernels {
+
+const BatchTable* avx512BatchTable() {
+	static constexpr BatchTable table = makeBatchTable<simd::native>(InstructionSet::AVX512, "AVX512");
+	return &table;
+}
+
+}
+}
+
+#else
+
+namespace animation {
+namespace kernels {
+
+const BatchTable* avx512BatchTable() {
+	return nullptr;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,43 @@
+// The batch easing kernels built for NEON on 32-bit ARM builds whose flags
+// leave it out, picked at run time by Interpolate when the kernel hwcaps
+// report NEON (see engine/batch_kernels.hpp). AArch64 and builds with
+// -mfpu=neon get NEON from the baseline kernels instead.
+#include "engine/batch_kernels.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__arm__) && !defined(__ARM_NEON) && !defined(__ARM_NEON__) && defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC push_options
+	#pragma GCC target("fpu=neon")
+
+	#define ANIMATION_SIMD_NEON
+	#include "engine/easing_kernels.hpp"
+
+	#pragma GCC pop_options
+
+namespace animation {
+namespace kernels {
+
+const BatchTable* neonBatchTable() {
+	static constexpr BatchTable table = makeBatchTable<simd::native>(InstructionSet::NEON, "NEON");
+	return &table;
+}
+
+}
+}
+
+#else
+
+namespace animation {
+namespace kernels {
+
+const BatchTable* neonBatchTable() {
+	return nullptr;
+}
+
+}
+}
+
+#endif
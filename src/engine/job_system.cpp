@@ -0,0 +1,149 @@
+#include "engine/job_system.hpp"
+
+namespace animation {
+
+JobSystem::JobSystem(std::size_t threadCount)
+		: m_function(nullptr)
+		, m_context(nullptr)
+		, m_pending(0)
+		, m_generation(0)
+		, m_stop(false) {
+
+	if (threadCount == 0)
+		threadCount = std::thread::hardware_concurrency();
+	if (threadCount == 0)
+		threadCount = 1;
+
+	for (std::size_t i = 0; i < threadCount; ++i) {
+		m_queues.emplace_back(new Queue());
+		m_queues.back()->head = 0;
+		m_queues.back()->tail = 0;
+	}
+
+	// The caller works as thread 0, so it needs no worker
+	for (std::size_t i = 1; i < threadCount; ++i)
+		m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+
+	for (std::thread& worker : m_workers)
+		worker.join();
+}
+
+std::size_t JobSystem::threadCount() const {
+	return m_queues.size();
+}
+
+void JobSystem::workerLoop(std::size_t index) {
+	std::size_t seen = 0;
+
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+			if (m_stop)
+				return;
+			seen = m_generation;
+		}
+
+		work(index);
+	}
+}
+
+bool JobSystem::take(std::size_t index, Range& range) {
+	const std::size_t count = m_queues.size();
+
+	// Own queue first, newest range first
+	{
+		Queue& own = *m_queues[index];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (own.head < own.tail) {
+			range = own.ranges[--own.tail];
+			return true;
+		}
+	}
+
+	// Then steal the oldest range of the next thread that has one
+	for (std::size_t k = 1; k < count; ++k) {
+		Queue& victim = *m_queues[(index + k) % count];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (victim.head < victim.tail) {
+			range = victim.ranges[victim.head++];
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::work(std::size_t index) {
+	Range range;
+
+	while (take(index, range)) {
+		m_function(m_context, range.begin, range.end);
+
+		// The last range to finish wakes the caller
+		if (m_pending.fetch_sub(1) == 1) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_done.notify_all();
+		}
+	}
+}
+
+void JobSystem::run(std::size_t count, std::size_t grain, RangeFunction function, void* context) {
+	if (count == 0)
+		return;
+	if (grain == 0)
+		grain = 1;
+
+	const std::size_t rangeCount = (count + grain - 1) / grain;
+	const std::size_t threads = m_queues.size();
+
+	// Nothing to share out: run the ranges in order on this thread
+	if (threads == 1 || rangeCount == 1) {
+		for (std::size_t begin = 0; begin < count; begin += grain)
+			function(context, begin, begin + grain < count ? begin + grain : count);
+		return;
+	}
+
+	// Set before the ranges are dealt; a worker only reads these after
+	// taking a range under its queue's lock
+	m_function = function;
+	m_context = context;
+	m_pending = rangeCount;
+
+	for (std::size_t t = 0; t < threads; ++t) {
+		Queue& queue = *m_queues[t];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+
+		queue.ranges.clear();
+		for (std::size_t r = t; r < rangeCount; r += threads) {
+			std::size_t begin = r * grain;
+			std::size_t end = begin + grain < count ? begin + grain : count;
+			queue.ranges.push_back(Range { begin, end });
+		}
+
+		queue.head = 0;
+		queue.tail = queue.ranges.size();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_generation;
+	}
+	m_wake.notify_all();
+
+	work(0);
+
+	// Other threads may still be running the ranges they took
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [&] { return m_pending.load() == 0; });
+}
+
+}
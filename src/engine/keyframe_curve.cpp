@@ -0,0 +1,120 @@
+#include "engine/keyframe_curve.hpp"
+#include "engine/branchless_search.hpp"
+#include "engine/easing.hpp"
+
+#include <cassert>
+
+namespace animation {
+
+namespace {
+	// Keys a cursor steps forward before falling back to the search
+	const std::size_t CURSOR_STEPS = 2;
+}
+
+void KeyframeCurve::addKey(float time, float value, InterpFunc function) {
+	assert(m_times.empty() || time >= m_times.back());
+
+	m_times.push_back(time);
+	m_values.push_back(value);
+	m_functions.push_back(static_cast<std::uint8_t>(function));
+}
+
+void KeyframeCurve::clear() {
+	m_times.clear();
+	m_values.clear();
+	m_functions.clear();
+}
+
+void KeyframeCurve::reserve(std::size_t keys) {
+	m_times.reserve(keys);
+	m_values.reserve(keys);
+	m_functions.reserve(keys);
+}
+
+std::size_t KeyframeCurve::keyCount() const {
+	return m_times.size();
+}
+
+float KeyframeCurve::startTime() const {
+	return m_times.empty() ? 0.f : m_times.front();
+}
+
+float KeyframeCurve::endTime() const {
+	return m_times.empty() ? 0.f : m_times.back();
+}
+
+float KeyframeCurve::time(std::size_t key) const {
+	return m_times[key];
+}
+
+float KeyframeCurve::value(std::size_t key) const {
+	return m_values[key];
+}
+
+InterpFunc KeyframeCurve::function(std::size_t key) const {
+	return static_cast<InterpFunc>(m_functions[key]);
+}
+
+// Index of the last key with times[i] <= time, clamped to a valid segment
+std::size_t KeyframeCurve::findSegment(float time) const {
+	return branchlessUpperIndex(m_times.data(), m_times.size(), time);
+}
+
+float KeyframeCurve::evaluateSegment(std::size_t segment, float time) const {
+	float t0 = m_times[segment];
+	float t1 = m_times[segment + 1];
+	float v0 = m_values[segment];
+	float v1 = m_values[segment + 1];
+
+	if (time <= t0) return v0;
+	if (time >= t1) return v1;
+
+	float u = (time - t0) / (t1 - t0);
+	InterpFunc func = static_cast<InterpFunc>(m_functions[segment]);
+	return v0 + (v1 - v0) * easing::evaluate(func, u);
+}
+
+float KeyframeCurve::evaluate(float time) const {
+	if (m_times.empty())
+		return 0.f;
+	if (m_times.size() == 1)
+		return m_values[0];
+
+	return evaluateSegment(findSegment(time), time);
+}
+
+float KeyframeCurve::evaluate(float time, KeyframeCursor& cursor) const {
+	if (m_times.empty())
+		return 0.f;
+	if (m_times.size() == 1)
+		return m_values[0];
+
+	const std::size_t last = m_times.size() - 2;
+	std::size_t segment = cursor.segment;
+
+	if (segment > last || time < m_times[segment]) {
+		// Stale cursor or a backwards seek
+		segment = findSegment(time);
+	}
+	else {
+		// Forward playback: usually stays put or moves by one key. A longer
+		// jump forward is a seek, so it searches instead of walking.
+		for (std::size_t step = 0; segment < last && time >= m_times[segment + 1]; ++step) {
+			if (step == CURSOR_STEPS) {
+				segment = findSegment(time);
+				break;
+			}
+			++segment;
+		}
+	}
+
+	cursor.segment = segment;
+	return evaluateSegment(segment, time);
+}
+
+void KeyframeCurve::evaluate(const float* times, float* out, std::size_t count, KeyframeCursor& cursor) const {
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = evaluate(times[i], cursor);
+}
+
+}
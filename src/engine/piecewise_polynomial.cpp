@@ -0,0 +1,187 @@
+#include "engine/piecewise_polynomial.hpp"
+#include "engine/branchless_search.hpp"
+#include "engine/easing.hpp"
+#include "engine/easing_expression.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace animation {
+
+const int PiecewisePolynomial::COEFFICIENTS = 5;
+const int PiecewisePolynomial::MAX_DEGREE = 4;
+const int PiecewisePolynomial::CHECK_POINTS = 32;
+const float PiecewisePolynomial::DEFAULT_TOLERANCE = 1e-4f;
+const float PiecewisePolynomial::MIN_SEGMENT_WIDTH = 1.f / 1048576.f;
+
+namespace {
+
+	// Samples are taken this far inside (0, 1) so the end jumps are not fitted
+	const double EDGE = 1e-6;
+
+	/** Coefficients of the polynomial through (x[i], y[i]), lowest power
+	first, by Gaussian elimination with partial pivoting on the
+	Vandermonde system. n is at most 5.
+	*/
+	void solveVandermonde(const double* x, const double* y, int n, double* coeffs) {
+		double m[5][6];
+
+		for (int r = 0; r < n; ++r) {
+			double p = 1.0;
+			for (int c = 0; c < n; ++c) {
+				m[r][c] = p;
+				p *= x[r];
+			}
+			m[r][n] = y[r];
+		}
+
+		for (int col = 0; col < n; ++col) {
+			int pivot = col;
+			for (int r = col + 1; r < n; ++r)
+				if (std::fabs(m[r][col]) > std::fabs(m[pivot][col]))
+					pivot = r;
+			std::swap(m[col], m[pivot]);
+
+			for (int r = col + 1; r < n; ++r) {
+				double f = m[r][col] / m[col][col];
+				for (int c = col; c <= n; ++c)
+					m[r][c] -= f * m[col][c];
+			}
+		}
+
+		for (int r = n - 1; r >= 0; --r) {
+			double s = m[r][n];
+			for (int c = r + 1; c < n; ++c)
+				s -= m[r][c] * coeffs[c];
+			coeffs[r] = s / m[r][r];
+		}
+	}
+}
+
+PiecewisePolynomial::PiecewisePolynomial(InterpFunc func, float tolerance, int degree)
+		: PiecewisePolynomial([func](float t) { return easing::evaluate(func, t); }, tolerance, degree) {
+}
+
+PiecewisePolynomial::PiecewisePolynomial(const CompiledEasing& curve, float tolerance, int degree)
+		: PiecewisePolynomial([&curve](float t) { return curve.apply(t); }, tolerance, degree) {
+}
+
+PiecewisePolynomial::PiecewisePolynomial(const std::function<float(float)>& curve, float tolerance, int degree)
+		: m_startValue(curve(0.f))
+		, m_endValue(curve(1.f))
+		, m_maxError(0.f)
+		, m_degree(degree) {
+	assert(degree >= 1 && degree <= MAX_DEGREE);
+	assert(tolerance > 0.f);
+
+	fit(curve, tolerance);
+}
+
+void PiecewisePolynomial::fit(const std::function<float(float)>& curve, float tolerance) {
+	m_breaks.assign(1, 0.f);
+	m_coefficients.clear();
+
+	fitInterval(curve, 0.0, 1.0, tolerance);
+}
+
+void PiecewisePolynomial::fitInterval(const std::function<float(float)>& curve, double a, double b, float tolerance) {
+	const double pi = 3.14159265358979323846;
+	const int n = m_degree + 1;
+	const double h = b - a;
+
+	auto sample = [&](double t) {
+		return static_cast<double>(curve(static_cast<float>(std::min(std::max(t, EDGE), 1.0 - EDGE))));
+	};
+
+	// Interpolate at Chebyshev-Lobatto nodes, which include both ends,
+	// in the scaled variable s = (t - a) / h for a well conditioned system
+	double s[5];
+	double y[5];
+	double c[5];
+	for (int i = 0; i < n; ++i) {
+		s[i] = 0.5 * (1.0 - std::cos(pi * i / m_degree));
+		y[i] = sample(a + h * s[i]);
+	}
+	solveVandermonde(s, y, n, c);
+
+	// Back to powers of (t - a), stored highest power first
+	float coeffs[5] = { 0.f, 0.f, 0.f, 0.f, 0.f };
+	double scale = 1.0;
+	for (int k = 0; k < n; ++k) {
+		coeffs[COEFFICIENTS - 1 - k] = static_cast<float>(c[k] / scale);
+		scale *= h;
+	}
+
+	// Error of the float evaluation against the curve
+	float error = 0.f;
+	for (int i = 0; i <= CHECK_POINTS; ++i) {
+		double t = a + h * i / CHECK_POINTS;
+		float u = static_cast<float>(t - a);
+		float p = coeffs[0];
+		for (int k = 1; k < COEFFICIENTS; ++k)
+			p = p * u + coeffs[k];
+
+		error = std::max(error, static_cast<float>(std::fabs(p - sample(t))));
+	}
+
+	if (error > tolerance && h > MIN_SEGMENT_WIDTH) {
+		double mid = a + h / 2.0;
+		fitInterval(curve, a, mid, tolerance);
+		fitInterval(curve, mid, b, tolerance);
+		return;
+	}
+
+	m_maxError = std::max(m_maxError, error);
+	m_breaks.push_back(static_cast<float>(b));
+	m_coefficients.insert(m_coefficients.end(), coeffs, coeffs + COEFFICIENTS);
+}
+
+std::size_t PiecewisePolynomial::findSegment(float t) const {
+	return branchlessUpperIndex(m_breaks.data(), m_breaks.size(), t);
+}
+
+float PiecewisePolynomial::evaluateSegment(std::size_t segment, float t) const {
+	const float* c = &m_coefficients[segment * COEFFICIENTS];
+	float u = t - m_breaks[segment];
+
+	return (((c[0] * u + c[1]) * u + c[2]) * u + c[3]) * u + c[4];
+}
+
+float PiecewisePolynomial::apply(float t) const {
+	if (t <= 0.f) return m_startValue;
+	if (t >= 1.f) return m_endValue;
+
+	return evaluateSegment(findSegment(t), t);
+}
+
+float PiecewisePolynomial::apply(float t, float b, float c, float d) const {
+	return b + c * apply(t / d);
+}
+
+void PiecewisePolynomial::evaluate(const float* t, float* out, std::size_t count) const {
+	for (std::size_t i = 0; i < count; ++i) {
+		float x = std::min(std::max(t[i], 0.f), 1.f);
+		float v = evaluateSegment(findSegment(x), x);
+
+		out[i] = t[i] <= 0.f ? m_startValue : (t[i] >= 1.f ? m_endValue : v);
+	}
+}
+
+std::size_t PiecewisePolynomial::segmentCount() const {
+	return m_breaks.size() - 1;
+}
+
+float PiecewisePolynomial::breakpoint(std::size_t index) const {
+	return m_breaks[index];
+}
+
+int PiecewisePolynomial::degree() const {
+	return m_degree;
+}
+
+float PiecewisePolynomial::maxError() const {
+	return m_maxError;
+}
+
+}
@@ -0,0 +1,177 @@
+#include "engine/spline_path.hpp"
+#include "engine/branchless_search.hpp"
+#include "engine/easing.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace animation {
+
+const std::size_t SplinePath::DEFAULT_SAMPLES_PER_SEGMENT = 32;
+
+namespace {
+
+	// Samples a cursor steps forward before falling back to the search
+	const std::size_t CURSOR_STEPS = 2;
+
+	sf::Vector2f catmullRom(const sf::Vector2f& p0, const sf::Vector2f& p1,
+							const sf::Vector2f& p2, const sf::Vector2f& p3, float u) {
+		float u2 = u * u;
+		float u3 = u2 * u;
+
+		return (p1 * 2.f
+			+ (p2 - p0) * u
+			+ (p0 * 2.f - p1 * 5.f + p2 * 4.f - p3) * u2
+			+ (p1 * 3.f - p0 - p2 * 3.f + p3) * u3) * 0.5f;
+	}
+
+	sf::Vector2f catmullRomTangent(const sf::Vector2f& p0, const sf::Vector2f& p1,
+								   const sf::Vector2f& p2, const sf::Vector2f& p3, float u) {
+		return ((p2 - p0)
+			+ (p0 * 2.f - p1 * 5.f + p2 * 4.f - p3) * (2.f * u)
+			+ (p1 * 3.f - p0 - p2 * 3.f + p3) * (3.f * u * u)) * 0.5f;
+	}
+
+	sf::Vector2f bezier(const sf::Vector2f* p, float u) {
+		float v = 1.f - u;
+		return p[0] * (v * v * v) + p[1] * (3.f * v * v * u) + p[2] * (3.f * v * u * u) + p[3] * (u * u * u);
+	}
+
+	sf::Vector2f bezierTangent(const sf::Vector2f* p, float u) {
+		float v = 1.f - u;
+		return (p[1] - p[0]) * (3.f * v * v) + (p[2] - p[1]) * (6.f * v * u) + (p[3] - p[2]) * (3.f * u * u);
+	}
+
+	float distance(const sf::Vector2f& a, const sf::Vector2f& b) {
+		sf::Vector2f d = b - a;
+		return std::sqrt(d.x * d.x + d.y * d.y);
+	}
+}
+
+SplinePath::SplinePath(SplineType type, const std::vector<sf::Vector2f>& points, std::size_t samplesPerSegment)
+		: m_type(type)
+		, m_points(points)
+		, m_samplesPerSegment(samplesPerSegment) {
+	assert(samplesPerSegment > 0);
+	assert(type == SplineType::Bezier
+		? points.size() >= 4 && (points.size() - 1) % 3 == 0
+		: points.size() >= 2);
+
+	const std::size_t samples = segmentCount() * m_samplesPerSegment;
+	m_lengths.resize(samples + 1);
+	m_lengths[0] = 0.f;
+
+	sf::Vector2f previous = pointAtParameter(0.f);
+	for (std::size_t i = 1; i <= samples; ++i) {
+		sf::Vector2f p = pointAtParameter(static_cast<float>(i) / m_samplesPerSegment);
+		m_lengths[i] = m_lengths[i - 1] + distance(previous, p);
+		previous = p;
+	}
+}
+
+SplineType SplinePath::type() const {
+	return m_type;
+}
+
+std::size_t SplinePath::segmentCount() const {
+	return m_type == SplineType::Bezier ? (m_points.size() - 1) / 3 : m_points.size() - 1;
+}
+
+float SplinePath::length() const {
+	return m_lengths.back();
+}
+
+sf::Vector2f SplinePath::pointAtParameter(float u) const {
+	const std::size_t last = segmentCount() - 1;
+	u = std::min(std::max(u, 0.f), static_cast<float>(segmentCount()));
+
+	std::size_t segment = std::min(static_cast<std::size_t>(u), last);
+	float local = u - static_cast<float>(segment);
+
+	if (m_type == SplineType::Bezier)
+		return bezier(&m_points[segment * 3], local);
+
+	const std::size_t n = m_points.size();
+	return catmullRom(m_points[segment == 0 ? 0 : segment - 1],
+					  m_points[segment],
+					  m_points[segment + 1],
+					  m_points[std::min(segment + 2, n - 1)],
+					  local);
+}
+
+std::size_t SplinePath::findSample(float distance) const {
+	return branchlessUpperIndex(m_lengths.data(), m_lengths.size(), distance);
+}
+
+float SplinePath::parameterAt(std::size_t sample, float distance) const {
+	float d0 = m_lengths[sample];
+	float d1 = m_lengths[sample + 1];
+	float f = d1 > d0 ? (distance - d0) / (d1 - d0) : 0.f;
+
+	f = std::min(std::max(f, 0.f), 1.f);
+	return (static_cast<float>(sample) + f) / static_cast<float>(m_samplesPerSegment);
+}
+
+sf::Vector2f SplinePath::positionAt(float distance) const {
+	return pointAtParameter(parameterAt(findSample(distance), distance));
+}
+
+sf::Vector2f SplinePath::positionAt(float distance, SplineCursor& cursor) const {
+	const std::size_t last = m_lengths.size() - 2;
+	std::size_t sample = cursor.sample;
+
+	if (sample > last || distance < m_lengths[sample]) {
+		// Jumped backwards: fall back to the binary search
+		sample = findSample(distance);
+	}
+	else {
+		// Step forward from the cached sample, one sample per frame at most
+		// in typical playback; a follower that skips further ahead searches
+		for (std::size_t step = 0; sample < last && distance >= m_lengths[sample + 1]; ++step) {
+			if (step == CURSOR_STEPS) {
+				sample = findSample(distance);
+				break;
+			}
+			++sample;
+		}
+	}
+
+	cursor.sample = sample;
+	return pointAtParameter(parameterAt(sample, distance));
+}
+
+sf::Vector2f SplinePath::tangentAt(float distance) const {
+	float u = parameterAt(findSample(distance), distance);
+	const std::size_t last = segmentCount() - 1;
+
+	std::size_t segment = std::min(static_cast<std::size_t>(u), last);
+	float local = u - static_cast<float>(segment);
+	sf::Vector2f d;
+
+	if (m_type == SplineType::Bezier) {
+		d = bezierTangent(&m_points[segment * 3], local);
+	}
+	else {
+		const std::size_t n = m_points.size();
+		d = catmullRomTangent(m_points[segment == 0 ? 0 : segment - 1],
+							  m_points[segment],
+							  m_points[segment + 1],
+							  m_points[std::min(segment + 2, n - 1)],
+							  local);
+	}
+
+	float len = std::sqrt(d.x * d.x + d.y * d.y);
+	return len > 0.f ? d * (1.f / len) : sf::Vector2f(0.f, 0.f);
+}
+
+sf::Vector2f SplinePath::evaluate(InterpFunc func, float t, SplineCursor& cursor) const {
+	return positionAt(easing::evaluate(func, t) * length(), cursor);
+}
+
+void SplinePath::evaluate(const float* distances, sf::Vector2f* out, std::size_t count, SplineCursor& cursor) const {
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = positionAt(distances[i], cursor);
+}
+
+}
@@ -0,0 +1,244 @@
+#include "engine/spring.hpp"
+#include "engine/simd.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace animation {
+
+const float Spring::SETTLE_TOLERANCE = 1e-3f;
+
+namespace {
+
+	const float LOG2E = 1.44269504f;
+	const float PI = 3.14159265f;
+
+	// Damping ratios this close to 1 use the critical solution
+	const float CRITICAL_BAND = 1e-4f;
+
+	/** Batch form of Spring::apply() for one simd lane type.
+
+	The regime is uniform across the batch, so only the end point tests
+	are per lane.
+	*/
+	template<class V>
+	V springLanes(V u, SpringRegime regime, float duration, float decay, float freq, float a, float b) {
+		using simd::splat;
+
+		V s = u * splat<V>(duration);
+		V x;
+
+		switch (regime) {
+		case SpringRegime::Underdamped: {
+			V e = simd::exp2(s * splat<V>(-decay * LOG2E));
+			V w = s * splat<V>(freq);
+			x = e * (splat<V>(a) * simd::cos(w) + splat<V>(b) * simd::sin(w));
+			break;
+		}
+		case SpringRegime::Critical:
+			x = simd::exp2(s * splat<V>(-decay * LOG2E)) * (splat<V>(a) + splat<V>(b) * s);
+			break;
+		default:
+			x = splat<V>(a) * simd::exp2(s * splat<V>(-decay * LOG2E))
+				+ splat<V>(b) * simd::exp2(s * splat<V>(-freq * LOG2E));
+			break;
+		}
+
+		V val = splat<V>(1.f) - x;
+		val = select(u >= splat<V>(1.f), splat<V>(1.f), val);
+		return select(splat<V>(0.f) >= u, splat<V>(0.f), val);
+	}
+}
+
+Spring::Spring(float stiffness, float damping, float mass, float initialVelocity)
+		: m_stiffness(stiffness)
+		, m_damping(damping)
+		, m_mass(mass) {
+	assert(stiffness > 0.f && damping > 0.f && mass > 0.f);
+
+	m_omega = std::sqrt(stiffness / mass);
+	m_ratio = damping / (2.f * std::sqrt(stiffness * mass));
+
+	// Displacement starts at 1 and moves toward 0
+	const float x0 = 1.f;
+	const float v0 = -initialVelocity;
+
+	if (m_ratio < 1.f - CRITICAL_BAND) {
+		// x = e^(-decay t) (a cos(freq t) + b sin(freq t))
+		m_regime = SpringRegime::Underdamped;
+		m_decay = m_ratio * m_omega;
+		m_freq = m_omega * std::sqrt(1.f - m_ratio * m_ratio);
+		m_a = x0;
+		m_b = (m_decay * x0 + v0) / m_freq;
+	}
+	else if (m_ratio <= 1.f + CRITICAL_BAND) {
+		// x = e^(-decay t) (a + b t)
+		m_regime = SpringRegime::Critical;
+		m_decay = m_omega;
+		m_freq = 0.f;
+		m_a = x0;
+		m_b = v0 + m_omega * x0;
+	}
+	else {
+		// x = a e^(-decay t) + b e^(-freq t), with decay the slower rate
+		m_regime = SpringRegime::Overdamped;
+		float root = std::sqrt(m_ratio * m_ratio - 1.f);
+		m_decay = m_omega * (m_ratio - root);
+		m_freq = m_omega * (m_ratio + root);
+		m_b = (v0 + m_decay * x0) / (m_decay - m_freq);
+		m_a = x0 - m_b;
+	}
+
+	m_duration = settleTime(SETTLE_TOLERANCE);
+}
+
+float Spring::displacement(float seconds) const {
+	switch (m_regime) {
+	case SpringRegime::Underdamped:
+		return std::exp(-m_decay * seconds)
+			* (m_a * std::cos(m_freq * seconds) + m_b * std::sin(m_freq * seconds));
+	case SpringRegime::Critical:
+		return std::exp(-m_decay * seconds) * (m_a + m_b * seconds);
+	default:
+		return m_a * std::exp(-m_decay * seconds) + m_b * std::exp(-m_freq * seconds);
+	}
+}
+
+float Spring::displacementVelocity(float seconds) const {
+	switch (m_regime) {
+	case SpringRegime::Underdamped: {
+		float c = std::cos(m_freq * seconds);
+		float s = std::sin(m_freq * seconds);
+		return std::exp(-m_decay * seconds)
+			* ((m_b * m_freq - m_decay * m_a) * c - (m_decay * m_b + m_a * m_freq) * s);
+	}
+	case SpringRegime::Critical:
+		return std::exp(-m_decay * seconds) * (m_b - m_decay * (m_a + m_b * seconds));
+	default:
+		return -m_decay * m_a * std::exp(-m_decay * seconds) - m_freq * m_b * std::exp(-m_freq * seconds);
+	}
+}
+
+// Time after which an upper bound of |displacement| stays below tolerance
+float Spring::settleTime(float tolerance) const {
+	float t = 0.f;
+
+	switch (m_regime) {
+	case SpringRegime::Underdamped:
+		t = std::log(std::sqrt(m_a * m_a + m_b * m_b) / tolerance) / m_decay;
+		break;
+	case SpringRegime::Critical:
+		// Fixed point of t = ln((|a| + |b| t) / tolerance) / decay
+		for (int i = 0; i < 32; ++i)
+			t = std::log((std::fabs(m_a) + std::fabs(m_b) * t) / tolerance) / m_decay;
+		break;
+	default:
+		t = std::log((std::fabs(m_a) + std::fabs(m_b)) / tolerance) / m_decay;
+		break;
+	}
+
+	// Keep the duration usable as a divisor
+	return std::max(t, 1e-3f);
+}
+
+float Spring::apply(float t) const {
+	if (t <= 0.f) return 0.f;
+	if (t >= 1.f) return 1.f;
+
+	return 1.f - displacement(t * m_duration);
+}
+
+float Spring::apply(float t, float b, float c, float d) const {
+	return c * apply(t / d) + b;
+}
+
+float Spring::position(float seconds) const {
+	return apply(seconds / m_duration);
+}
+
+float Spring::velocity(float t) const {
+	t = std::min(std::max(t, 0.f), 1.f);
+	return -displacementVelocity(t * m_duration) * m_duration;
+}
+
+float Spring::acceleration(float t) const {
+	t = std::min(std::max(t, 0.f), 1.f);
+
+	// From the equation of motion: m x'' = -k x - c x'
+	float seconds = t * m_duration;
+	float x = displacement(seconds);
+	float v = displacementVelocity(seconds);
+	return (m_stiffness * x + m_damping * v) / m_mass * m_duration * m_duration;
+}
+
+float Spring::inverse(float value) const {
+	float lo = 0.f;
+	float hi = 1.f;
+
+	if (m_regime == SpringRegime::Underdamped) {
+		// Velocity zeros satisfy tan(freq t) = x'(0) / (decay b + a freq); take
+		// the first one after t = 0 rather than the principal branch
+		float rate = m_b * m_freq - m_decay * m_a;
+		float theta = std::atan(rate / (m_decay * m_b + m_a * m_freq));
+		if (theta <= 0.f)
+			theta += PI;
+
+		if (rate <= 0.f) {
+			// Rising from the start, the first velocity zero is the overshoot peak
+			hi = std::min(theta / m_freq / m_duration, 1.f);
+		}
+		else {
+			// Moving away first, the approach starts at the first velocity zero
+			// and ends at the overshoot peak, half a period later
+			lo = std::min(theta / m_freq / m_duration, 1.f);
+			hi = std::min((theta + PI) / m_freq / m_duration, 1.f);
+		}
+	}
+
+	// apply() rises monotonically on [lo, hi]
+	for (int i = 0; i < 32; ++i) {
+		float mid = 0.5f * (lo + hi);
+		if (apply(mid) < value)
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	return 0.5f * (lo + hi);
+}
+
+void Spring::evaluate(const float* t, float* out, std::size_t count) const {
+	typedef simd::native V;
+	const std::size_t width = V::width;
+	std::size_t i = 0;
+
+	for (; i + width <= count; i += width) {
+		V u = simd::load(t + i, V());
+		simd::store(out + i, springLanes(u, m_regime, m_duration, m_decay, m_freq, m_a, m_b));
+	}
+
+	for (; i < count; ++i) {
+		simd::f32x1 u = { t[i] };
+		out[i] = springLanes(u, m_regime, m_duration, m_decay, m_freq, m_a, m_b).v;
+	}
+}
+
+float Spring::settleDuration() const {
+	return m_duration;
+}
+
+float Spring::settleDuration(float stiffness, float damping, float mass,
+							 float initialVelocity, float tolerance) {
+	return Spring(stiffness, damping, mass, initialVelocity).settleTime(tolerance);
+}
+
+SpringRegime Spring::regime() const {
+	return m_regime;
+}
+
+float Spring::dampingRatio() const {
+	return m_ratio;
+}
+
+}
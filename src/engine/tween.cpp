@@ -1,16 +1,26 @@
 #include "engine/tween.hpp"
-#include "engine/interpolate.hpp"
+#include "engine/easing.hpp"
+#include "engine/easing_table.hpp"
+#include "engine/easing_inverse.hpp"
+#include "engine/cubic_bezier.hpp"
+#include "engine/spring.hpp"
 
 using namespace animation;
 
+EasingPrecision Tween::s_defaultPrecision = EasingPrecision::Exact;
+
 Tween::Tween()
 		: m_function(InterpFunc::QuartEaseOut)
+		, m_bezier(nullptr)
+		, m_spring(nullptr)
 		, m_startValue(0.f)
 		, m_targetValue(0.f)
 		, m_changeValue(0.f)
 		, m_duration(0.f)
 		, m_elapsedTime(0.f)
-		, m_isAnimating(false) {
+		, m_isAnimating(false)
+		, m_useTable(false)
+		, m_precision(EasingPrecision::Default) {
 	m_property = nullptr;
 }
 
@@ -18,15 +28,30 @@ Tween::Tween()
 Tween::Tween(float* property, float startValue, float targetValue, float duration,
 			 InterpFunc function)
 		: m_function(function)
+		, m_bezier(nullptr)
+		, m_spring(nullptr)
 		, m_startValue(startValue)
 		, m_targetValue(targetValue)
 		, m_changeValue(targetValue-startValue)
 		, m_duration(duration)
 		, m_elapsedTime(0.f)
-		, m_isAnimating(false) {
+		, m_isAnimating(false)
+		, m_useTable(false)
+		, m_precision(EasingPrecision::Default) {
 	m_property = property;
 }
 
+Tween::Tween(float* property, float startValue, float targetValue, float duration,
+			 const CubicBezier& curve)
+		: Tween(property, startValue, targetValue, duration) {
+	m_bezier = &curve;
+}
+
+Tween::Tween(float* property, float startValue, float targetValue, const Spring& spring)
+		: Tween(property, startValue, targetValue, spring.settleDuration()) {
+	m_spring = &spring;
+}
+
 Tween::~Tween() {
 	// The animated property pointer is pointing to a
 	// stack variable or dynamically allocated data that
@@ -57,6 +82,98 @@ bool Tween::isAnimating() const {
 	return m_isAnimating;
 }
 
+float Tween::getVelocity() const {
+	if (!m_isAnimating || m_duration <= 0.f)
+		return 0.f;
+
+	if (m_bezier)
+		return m_changeValue / m_duration * m_bezier->velocity(m_elapsedTime / m_duration);
+	if (m_spring)
+		return m_changeValue / m_duration * m_spring->velocity(m_elapsedTime / m_duration);
+
+	return easing::velocity(m_function, m_elapsedTime, m_startValue, m_changeValue, m_duration);
+}
+
+float Tween::getAcceleration() const {
+	if (!m_isAnimating || m_duration <= 0.f)
+		return 0.f;
+
+	if (m_bezier)
+		return m_changeValue / (m_duration * m_duration) * m_bezier->acceleration(m_elapsedTime / m_duration);
+	if (m_spring)
+		return m_changeValue / (m_duration * m_duration) * m_spring->acceleration(m_elapsedTime / m_duration);
+
+	return easing::acceleration(m_function, m_elapsedTime, m_startValue, m_changeValue, m_duration);
+}
+
+void Tween::seekToValue(float value) {
+	if (m_bezier) {
+		float u = m_changeValue != 0.f ? (value - m_startValue) / m_changeValue : 0.f;
+		m_elapsedTime = m_duration * m_bezier->inverse(u);
+	}
+	else if (m_spring) {
+		float u = m_changeValue != 0.f ? (value - m_startValue) / m_changeValue : 0.f;
+		m_elapsedTime = m_duration * m_spring->inverse(u);
+	}
+	else {
+		m_elapsedTime = EasingInverse::solve(m_function, value, m_startValue, m_changeValue, m_duration);
+	}
+
+	(*m_property) = value;
+}
+
+void Tween::seek(float elapsedTime) {
+	if (elapsedTime < 0.f)
+		elapsedTime = 0.f;
+
+	if (elapsedTime >= m_duration) {
+		m_elapsedTime = m_duration;
+		(*m_property) = m_targetValue;
+		return;
+	}
+
+	m_elapsedTime = elapsedTime;
+	(*m_property) = valueAt(elapsedTime);
+}
+
+float Tween::getElapsedTime() const {
+	return m_elapsedTime;
+}
+
+void Tween::setCurve(const CubicBezier* curve) {
+	m_bezier = curve;
+}
+
+void Tween::setSpring(const Spring* spring) {
+	m_spring = spring;
+}
+
+void Tween::useTable(bool b) {
+	if (b && !EasingTable::isBuilt())
+		EasingTable::build();
+
+	m_useTable = b;
+}
+
+void Tween::setPrecision(EasingPrecision precision) {
+	m_precision = precision;
+}
+
+EasingPrecision Tween::getPrecision() const {
+	return m_precision;
+}
+
+void Tween::setDefaultPrecision(EasingPrecision precision) {
+	// Default would refer back to itself
+	s_defaultPrecision = precision == EasingPrecision::Default
+		? EasingPrecision::Exact
+		: precision;
+}
+
+EasingPrecision Tween::getDefaultPrecision() {
+	return s_defaultPrecision;
+}
+
 void Tween::update(float dt) {
 	// Update the tween if it's animating
 	if (m_isAnimating) {
@@ -73,139 +190,35 @@ void Tween::update(float dt) {
 		}
 
 		// Otherwise, continue the animation
-		float t = m_elapsedTime;
-		float b = m_startValue;
-		float c = m_changeValue;
-		float d = m_duration;
-
-		switch (m_function) {
-		case InterpFunc::Linear:
-			(*m_property) = Interpolate::linear(t, b, c, d);
-			break;
-
-		case InterpFunc::QuadEaseIn:
-			(*m_property) = Interpolate::easeInQuad(t, b, c, d);
-			break;
-
-		case InterpFunc::QuadEaseOut:
-			(*m_property) = Interpolate::easeOutQuad(t, b, c, d);
-			break;
-
-		case InterpFunc::QuadEaseInOut:
-			(*m_property) = Interpolate::easeInOutQuad(t, b, c, d);
-			break;
-
-		case InterpFunc::CubicEaseIn:
-			(*m_property) = Interpolate::easeInCubic(t, b, c, d);
-			break;
-
-		case InterpFunc::CubicEaseOut:
-			(*m_property) = Interpolate::easeOutCubic(t, b, c, d);
-			break;
+		(*m_property) = valueAt(m_elapsedTime);
+	}
+}
 
-		case InterpFunc::CubicEaseInOut:
-			(*m_property) = Interpolate::easeInOutCubic(t, b, c, d);
-			break;
-
-		case InterpFunc::QuartEaseIn:
-			(*m_property) = Interpolate::easeInQuart(t, b, c, d);
-			break;
-
-		case InterpFunc::QuartEaseOut:
-			(*m_property) = Interpolate::easeOutQuart(t, b, c, d);
-			break;
-
-		case InterpFunc::QuartEaseInOut:
-			(*m_property) = Interpolate::easeInOutQuart(t, b, c, d);
-			break;
-
-		case InterpFunc::QuintEaseIn:
-			(*m_property) = Interpolate::easeInQuint(t, b, c, d);
-			break;
-
-		case InterpFunc::QuintEaseOut:
-			(*m_property) = Interpolate::easeOutQuint(t, b, c, d);
-			break;
-
-		case InterpFunc::QuintEaseInOut:
-			(*m_property) = Interpolate::easeInOutQuint(t, b, c, d);
-			break;
-
-		case InterpFunc::SineEaseIn:
-			(*m_property) = Interpolate::easeInSine(t, b, c, d);
-			break;
-
-		case InterpFunc::SineEaseOut:
-			(*m_property) = Interpolate::easeOutSine(t, b, c, d);
-			break;
-
-		case InterpFunc::SineEaseInOut:
-			(*m_property) = Interpolate::easeInOutSine(t, b, c, d);
-			break;
-
-		case InterpFunc::ExpoEaseIn:
-			(*m_property) = Interpolate::easeInExpo(t, b, c, d);
-			break;
-
-		case InterpFunc::ExpoEaseOut:
-			(*m_property) = Interpolate::easeOutExpo(t, b, c, d);
-			break;
-
-		case InterpFunc::ExpoEaseInOut:
-			(*m_property) = Interpolate::easeInOutExpo(t, b, c, d);
-			break;
-
-		case InterpFunc::CircEaseIn:
-			(*m_property) = Interpolate::easeInCirc(t, b, c, d);
-			break;
-
-		case InterpFunc::CircEaseOut:
-			(*m_property) = Interpolate::easeOutCirc(t, b, c, d);
-			break;
-
-		case InterpFunc::CircEaseInOut:
-			(*m_property) = Interpolate::easeInOutCirc(t, b, c, d);
-			break;
-
-		case InterpFunc::BackEaseIn:
-			(*m_property) = Interpolate::easeInBack(t, b, c, d);
-			break;
-
-		case InterpFunc::BackEaseOut:
-			(*m_property) = Interpolate::easeOutBack(t, b, c, d);
-			break;
-
-		case InterpFunc::BackEaseInOut:
-			(*m_property) = Interpolate::easeInOutBack(t, b, c, d);
-			break;
-
-		case InterpFunc::ElasticEaseIn:
-			(*m_property) = Interpolate::easeInElastic(t, b, c, d);
-			break;
+float Tween::valueAt(float t) const {
+	float b = m_startValue;
+	float c = m_changeValue;
+	float d = m_duration;
 
-		case InterpFunc::ElasticEaseOut:
-			(*m_property) = Interpolate::easeOutElastic(t, b, c, d);
-			break;
+	if (m_bezier)
+		return m_bezier->apply(t, b, c, d);
 
-		case InterpFunc::ElasticEaseInOut:
-			(*m_property) = Interpolate::easeInOutElastic(t, b, c, d);
-			break;
+	if (m_spring)
+		return m_spring->apply(t, b, c, d);
 
-		case InterpFunc::BounceEaseIn:
-			(*m_property) = Interpolate::easeInBounce(t, b, c, d);
-			break;
+	if (m_useTable)
+		return EasingTable::evaluate(m_function, t, b, c, d);
 
-		case InterpFunc::BounceEaseOut:
-			(*m_property) = Interpolate::easeOutBounce(t, b, c, d);
-			break;
+	EasingPrecision precision = m_precision == EasingPrecision::Default
+		? s_defaultPrecision
+		: m_precision;
 
-		case InterpFunc::BounceEaseInOut:
-			(*m_property) = Interpolate::easeInOutBounce(t, b, c, d);
-			break;
+	if (precision != EasingPrecision::Exact)
+		return easing::evaluate(m_function, precision, t, b, c, d);
 
-		default:
-			(*m_property) = Interpolate::easeOutQuart(t, b, c, d);
-			break;
-		}
-	}
+	// Resolve the curve once; its functor body is inlined here
+	float value = 0.f;
+	easing::dispatch(m_function, [&](auto curve) {
+		value = decltype(curve)::apply(t, b, c, d);
+	});
+	return value;
 }
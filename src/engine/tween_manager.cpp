@@ -0,0 +1,264 @@
+#include "engine/tween_manager.hpp"
+#include "engine/tween.hpp"
+#include "engine/easing.hpp"
+#include "engine/interpolate.hpp"
+#include "engine/job_system.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+using namespace animation;
+
+namespace {
+	// Arrays per bucket, which always grow together
+	const std::size_t BUCKET_ARRAYS = 7;
+}
+
+const std::size_t TweenManager::CHUNK_SIZE = 4096;
+
+static_assert(TweenManager::CHUNK_SIZE % (CACHE_LINE_SIZE / sizeof(float)) == 0,
+			  "TweenManager chunks must start on a cache line");
+
+TweenManager::TweenManager()
+		: m_allocations(0) {
+}
+
+std::size_t TweenManager::bucketIndex(InterpFunc function) {
+	int id = static_cast<int>(function);
+	if (id < 1 || id > INTERP_FUNC_COUNT)
+		id = static_cast<int>(InterpFunc::QuartEaseOut);
+
+	return static_cast<std::size_t>(id - 1);
+}
+
+void TweenManager::add(float* property, float startValue, float targetValue, float duration,
+					   InterpFunc function, float elapsedTime) {
+	Bucket& bucket = m_buckets[bucketIndex(function)];
+	const std::size_t capacity = bucket.properties.capacity();
+
+	bucket.properties.push_back(property);
+	bucket.startValues.push_back(startValue);
+	bucket.changeValues.push_back(targetValue - startValue);
+	bucket.targetValues.push_back(targetValue);
+	bucket.durations.push_back(duration);
+	bucket.elapsedTimes.push_back(std::min(elapsedTime, duration));
+	bucket.values.push_back(startValue);
+
+	if (bucket.properties.capacity() != capacity)
+		m_allocations += BUCKET_ARRAYS;
+}
+
+void TweenManager::remove(Bucket& bucket, std::size_t index) {
+	const std::size_t last = bucket.properties.size() - 1;
+
+	bucket.properties[index]   = bucket.properties[last];
+	bucket.startValues[index]  = bucket.startValues[last];
+	bucket.changeValues[index] = bucket.changeValues[last];
+	bucket.targetValues[index] = bucket.targetValues[last];
+	bucket.durations[index]    = bucket.durations[last];
+	bucket.elapsedTimes[index] = bucket.elapsedTimes[last];
+	bucket.values[index]       = bucket.values[last];
+
+	bucket.properties.pop_back();
+	bucket.startValues.pop_back();
+	bucket.changeValues.pop_back();
+	bucket.targetValues.pop_back();
+	bucket.durations.pop_back();
+	bucket.elapsedTimes.pop_back();
+	bucket.values.pop_back();
+}
+
+template<class M>
+void TweenManager::advance(Bucket& bucket, InterpFunc function, std::size_t begin, std::size_t end,
+						   float dt) {
+	float* elapsedTimes = bucket.elapsedTimes.data();
+	float* values = bucket.values.data();
+	const float* startValues = bucket.startValues.data();
+	const float* changeValues = bucket.changeValues.data();
+	const float* durations = bucket.durations.data();
+
+	// Finished tweens are clamped to their duration here and get their
+	// exact target in finish()
+	for (std::size_t i = begin; i < end; ++i)
+		elapsedTimes[i] = std::min(elapsedTimes[i] + dt, durations[i]);
+
+	if (std::is_same<M, fastmath::ExactMath>::value) {
+		// The only switch on the function, once per bucket or chunk
+		easing::dispatch<M>(function, [&](auto curve) {
+			typedef decltype(curve) Curve;
+
+			for (std::size_t i = begin; i < end; ++i)
+				values[i] = Curve::apply(elapsedTimes[i], startValues[i], changeValues[i], durations[i]);
+		});
+	}
+	else {
+		// The arrays are already in batch layout, so the run-time selected
+		// kernels do the work. They match FastMath within BATCH_TOLERANCE,
+		// which Fastest also gets at no extra cost.
+		Interpolate::evaluate(function, elapsedTimes + begin, startValues + begin, changeValues + begin,
+							  durations + begin, values + begin, end - begin);
+	}
+}
+
+void TweenManager::finish(Bucket& bucket) {
+	const std::size_t count = bucket.properties.size();
+
+	std::size_t finished = 0;
+	for (std::size_t i = 0; i < count; ++i) {
+		if (bucket.elapsedTimes[i] >= bucket.durations[i]) {
+			(*bucket.properties[i]) = bucket.targetValues[i];
+			++finished;
+		}
+		else {
+			(*bucket.properties[i]) = bucket.values[i];
+		}
+	}
+
+	// The tween moved into slot i has not been checked yet, so i stays put
+	std::size_t i = 0;
+	while (finished > 0) {
+		if (bucket.elapsedTimes[i] >= bucket.durations[i]) {
+			remove(bucket, i);
+			--finished;
+		}
+		else {
+			++i;
+		}
+	}
+}
+
+template<class M>
+void TweenManager::updateBuckets(float dt, JobSystem* jobs) {
+	if (jobs != nullptr && jobs->threadCount() > 1) {
+		const std::size_t capacity = m_chunks.capacity();
+		m_chunks.clear();
+
+		for (std::size_t index = 0; index < INTERP_FUNC_COUNT; ++index) {
+			const std::size_t count = m_buckets[index].properties.size();
+			for (std::size_t begin = 0; begin < count; begin += CHUNK_SIZE)
+				m_chunks.push_back(Chunk { index, begin, std::min(begin + CHUNK_SIZE, count) });
+		}
+
+		if (m_chunks.capacity() != capacity)
+			++m_allocations;
+
+		// Each chunk writes only its own slice of one bucket's arrays
+		jobs->parallelFor(m_chunks.size(), 1, [&](std::size_t first, std::size_t last) {
+			for (std::size_t c = first; c < last; ++c) {
+				const Chunk& chunk = m_chunks[c];
+				InterpFunc function = static_cast<InterpFunc>(chunk.bucket + 1);
+				advance<M>(m_buckets[chunk.bucket], function, chunk.begin, chunk.end, dt);
+			}
+		});
+	}
+	else {
+		for (std::size_t index = 0; index < INTERP_FUNC_COUNT; ++index) {
+			Bucket& bucket = m_buckets[index];
+			if (bucket.properties.empty())
+				continue;
+
+			InterpFunc function = static_cast<InterpFunc>(index + 1);
+			advance<M>(bucket, function, 0, bucket.properties.size(), dt);
+		}
+	}
+
+	// Properties are written on this thread in bucket order whatever the
+	// thread count, so tweens sharing a property resolve the same way
+	for (Bucket& bucket : m_buckets) {
+		if (!bucket.properties.empty())
+			finish(bucket);
+	}
+}
+
+void TweenManager::update(float dt) {
+	// Same math policies as Tween::update()
+	switch (Tween::getDefaultPrecision()) {
+	case EasingPrecision::Fast:    updateBuckets<fastmath::FastMath>(dt, nullptr); break;
+	case EasingPrecision::Fastest: updateBuckets<fastmath::FastestMath>(dt, nullptr); break;
+	default:                       updateBuckets<fastmath::ExactMath>(dt, nullptr); break;
+	}
+}
+
+void TweenManager::update(float dt, JobSystem& jobs) {
+	switch (Tween::getDefaultPrecision()) {
+	case EasingPrecision::Fast:    updateBuckets<fastmath::FastMath>(dt, &jobs); break;
+	case EasingPrecision::Fastest: updateBuckets<fastmath::FastestMath>(dt, &jobs); break;
+	default:                       updateBuckets<fastmath::ExactMath>(dt, &jobs); break;
+	}
+}
+
+std::size_t TweenManager::stop(const float* property) {
+	std::size_t removed = 0;
+
+	for (Bucket& bucket : m_buckets) {
+		std::size_t i = 0;
+
+		while (i < bucket.properties.size()) {
+			if (bucket.properties[i] == property) {
+				remove(bucket, i);
+				++removed;
+			}
+			else {
+				++i;
+			}
+		}
+	}
+
+	return removed;
+}
+
+bool TweenManager::isAnimating(const float* property) const {
+	for (const Bucket& bucket : m_buckets) {
+		for (const float* p : bucket.properties) {
+			if (p == property)
+				return true;
+		}
+	}
+	return false;
+}
+
+void TweenManager::clear() {
+	for (Bucket& bucket : m_buckets) {
+		bucket.properties.clear();
+		bucket.startValues.clear();
+		bucket.changeValues.clear();
+		bucket.targetValues.clear();
+		bucket.durations.clear();
+		bucket.elapsedTimes.clear();
+		bucket.values.clear();
+	}
+}
+
+void TweenManager::reserve(std::size_t count) {
+	for (Bucket& bucket : m_buckets) {
+		if (bucket.properties.capacity() < count)
+			m_allocations += BUCKET_ARRAYS;
+
+		bucket.properties.reserve(count);
+		bucket.startValues.reserve(count);
+		bucket.changeValues.reserve(count);
+		bucket.targetValues.reserve(count);
+		bucket.durations.reserve(count);
+		bucket.elapsedTimes.reserve(count);
+		bucket.values.reserve(count);
+	}
+}
+
+std::size_t TweenManager::size() const {
+	std::size_t total = 0;
+	for (const Bucket& bucket : m_buckets)
+		total += bucket.properties.size();
+	return total;
+}
+
+bool TweenManager::empty() const {
+	return size() == 0;
+}
+
+std::size_t TweenManager::size(InterpFunc function) const {
+	return m_buckets[bucketIndex(function)].properties.size();
+}
+
+std::size_t TweenManager::allocationCount() const {
+	return m_allocations;
+}
@@ -6,8 +6,11 @@
 
 #include "engine/button.hpp"
 #include "engine/circle.hpp"
+#include "engine/easing.hpp"
 #include "engine/interpolate.hpp"
 #include "engine/tween.hpp"
+#include "engine/tween_manager.hpp"
+#include "engine/tween_pool.hpp"
 #include "engine/camera.hpp"
 #include "engine/utils.hpp"
 
@@ -16,6 +19,7 @@
 #include "imgui/imgui_utils.hpp"
 
 using namespace animation;
+using animation::easing::ease;
 using namespace demo::camera;
 
 Circle makeCircle(const sf::Color& color) {
@@ -32,6 +36,9 @@ int main()
 {
     util::Platform platform;
 
+    std::cout << "Easing kernels: " << Interpolate::batchInstructionSet()
+              << " (" << CpuFeatures::describe() << ")\n";
+
     Vector2f resolution(1024.f, 640.f);
     sf::RenderWindow window(sf::VideoMode(resolution.x,resolution.y,32), "Camera Animation Using Easing Functions With SFML", sf::Style::Default);
 
@@ -68,6 +75,11 @@ int main()
  ------------------------------------------------------------*/
 void CameraDemo(RenderWindow& window, const Vector2f& resolution) {
 
+    // Camera tweens; the pool outlives the camera that animates in it.
+    // The camera runs one tween at a time, so one slot is allocated up
+    // front and switching players never allocates.
+    TweenPool<ValueTween<Vector2f>> cameraTweens(1, PoolGrowth::Fixed);
+
     // Camera switch demo
     Circle player1(Vector2f(500.f, 575.f), sf::Color::Yellow, 30.f);
     Circle player2(Vector2f(800.f, 675.f), sf::Color::Green, 30.f);
@@ -123,7 +135,7 @@ void CameraDemo(RenderWindow& window, const Vector2f& resolution) {
     // ------------------------------
     // Camera
     // ------------------------------
-    Camera camera(player1.getCenter(), background.getTexture()->getSize(),
+    Camera camera(cameraTweens, player1.getCenter(), background.getTexture()->getSize(),
         resolution, true);
     camera.setDuration(.5f);
     camera.setInterpolation(InterpFunc::ElasticEaseOut);
@@ -188,7 +200,7 @@ void CameraDemo(RenderWindow& window, const Vector2f& resolution) {
                         }
 
                         player1Active = !player1Active;
-                    }// !tweenXActive && !tweenYActive
+                    }// !camera.isAnimating()
                 }// event.key.code == sf::Keyboard::Space
             }
         }
@@ -357,11 +369,12 @@ void CameraDemo(RenderWindow& window, const Vector2f& resolution) {
         }
 
         // Update camera (make it follow the player or animate to the active player)
+        cameraTweens.update(dt.asSeconds());
         if (player1Active) {
-            camera.update(dt.asSeconds(), player1);
+            camera.update(player1);
         }
         else {
-            camera.update(dt.asSeconds(), player2);
+            camera.update(player2);
         }
 
         // Center view on camera's position
@@ -394,8 +407,18 @@ void CameraDemo(RenderWindow& window, const Vector2f& resolution) {
  Tween spawn circle demo
  ------------------------------------------------------------*/
 void TweenSpawnDemo(RenderWindow& window, const Vector2f& resolution) {
+    // Demo tween pool; declared first so it outlives the circle. It
+    // holds the circle's one demo tween and never allocates again.
+    TweenPool<Tween> demoTweens(1, PoolGrowth::Fixed);
+
+    // Runs the spawned tweens; declared first so it outlives the circle
+    TweenManager tweens;
+
     Circle circle(Vector2f(30.f, 275.f), Color::Yellow, 50.f);
-    circle.createDemoTween();
+    circle.createDemoTween(demoTweens);
+
+    std::vector<std::string> easingLabels;
+    initEasingLabels(easingLabels);
 
     sf::Clock clock;
 
@@ -477,11 +500,11 @@ void TweenSpawnDemo(RenderWindow& window, const Vector2f& resolution) {
                 }
 
                 if (event.key.code == sf::Keyboard::LShift) {
-                    circle.spawnInTween();
+                    circle.spawnInTween(tweens);
                 }
 
                 if (event.key.code == sf::Keyboard::RShift) {
-                    circle.spawnOutTween();
+                    circle.spawnOutTween(tweens);
                 }
             }
         }
@@ -517,6 +540,22 @@ void TweenSpawnDemo(RenderWindow& window, const Vector2f& resolution) {
         // update ImGui
         ImGui::SFML::Update(window, dt);
 
+        // Running tweens per easing function, one bucket each
+        ImGui::Begin("Tween Manager");
+        ImGui::Text("Running: %u", static_cast<unsigned>(tweens.size()));
+        ImGui::Text("Allocations: %u (demo pool: %u)",
+            static_cast<unsigned>(tweens.allocationCount()),
+            static_cast<unsigned>(demoTweens.allocationCount()));
+        for (int id = 1; id <= INTERP_FUNC_COUNT; ++id) {
+            std::size_t count = tweens.size(static_cast<InterpFunc>(id));
+            if (count > 0) {
+                ImGui::Text("%s: %u", easingLabels[id - 1].c_str(), static_cast<unsigned>(count));
+            }
+        }
+        ImGui::End();
+
+        demoTweens.update(dt.asSeconds());
+        tweens.update(dt.asSeconds());
         circle.update(dt.asSeconds());
 
         // Draw
@@ -783,17 +822,17 @@ void EasingDemo(RenderWindow& window, const Vector2f& resolution) {
                 {
                     float t = duration.asSeconds();
 
-                    circle_linear.setPosition(Interpolate::linear(t, 140.f, changeX, dur), 90.f);
-                    circle_quadratic.setPosition(Interpolate::easeInQuad(t, 140.f, changeX, dur), 127.f);
-                    circle_cubic.setPosition(Interpolate::easeInCubic(t, 140.f, changeX, dur), 162.f);
-                    circle_quartic.setPosition(Interpolate::easeInQuart(t, 140.f, changeX, dur), 198.f);
-                    circle_quintic.setPosition(Interpolate::easeInQuint(t, 140.f, changeX, dur), 234.f);
-                    circle_sinesoidal.setPosition(Interpolate::easeInSine(t, 140.f, changeX, dur), 270.f);
-                    circle_exponential.setPosition(Interpolate::easeInExpo(t, 140.f, changeX, dur), 306.f);
-                    circle_circular.setPosition(Interpolate::easeInCirc(t, 140.f, changeX, dur), 342.f);
-                    circle_back.setPosition(Interpolate::easeInBack(t, 140.f, changeX, dur), 378.f);
-                    circle_elastic.setPosition(Interpolate::easeInElastic(t, 140.f, changeX, dur), 414.f);
-                    circle_bounce.setPosition(Interpolate::easeInBounce(t, 140.f, changeX, dur), 450.f);
+                    circle_linear.setPosition(ease<InterpFunc::Linear>(t, 140.f, changeX, dur), 90.f);
+                    circle_quadratic.setPosition(ease<InterpFunc::QuadEaseIn>(t, 140.f, changeX, dur), 127.f);
+                    circle_cubic.setPosition(ease<InterpFunc::CubicEaseIn>(t, 140.f, changeX, dur), 162.f);
+                    circle_quartic.setPosition(ease<InterpFunc::QuartEaseIn>(t, 140.f, changeX, dur), 198.f);
+                    circle_quintic.setPosition(ease<InterpFunc::QuintEaseIn>(t, 140.f, changeX, dur), 234.f);
+                    circle_sinesoidal.setPosition(ease<InterpFunc::SineEaseIn>(t, 140.f, changeX, dur), 270.f);
+                    circle_exponential.setPosition(ease<InterpFunc::ExpoEaseIn>(t, 140.f, changeX, dur), 306.f);
+                    circle_circular.setPosition(ease<InterpFunc::CircEaseIn>(t, 140.f, changeX, dur), 342.f);
+                    circle_back.setPosition(ease<InterpFunc::BackEaseIn>(t, 140.f, changeX, dur), 378.f);
+                    circle_elastic.setPosition(ease<InterpFunc::ElasticEaseIn>(t, 140.f, changeX, dur), 414.f);
+                    circle_bounce.setPosition(ease<InterpFunc::BounceEaseIn>(t, 140.f, changeX, dur), 450.f);
                 }
             }
             break;
@@ -804,17 +843,17 @@ void EasingDemo(RenderWindow& window, const Vector2f& resolution) {
                 {
                     float t = duration.asSeconds();
 
-                    circle_linear.setPosition(Interpolate::linear(t, 140.f, changeX, dur), 90.f);
-                    circle_quadratic.setPosition(Interpolate::easeOutQuad(t, 140.f, changeX, dur), 127.f);
-                    circle_cubic.setPosition(Interpolate::easeOutCubic(t, 140.f, changeX, dur), 162.f);
-                    circle_quartic.setPosition(Interpolate::easeOutQuart(t, 140.f, changeX, dur), 198.f);
-                    circle_quintic.setPosition(Interpolate::easeOutQuint(t, 140.f, changeX, dur), 234.f);
-                    circle_sinesoidal.setPosition(Interpolate::easeOutSine(t, 140.f, changeX, dur), 270.f);
-                    circle_exponential.setPosition(Interpolate::easeOutExpo(t, 140.f, changeX, dur), 306.f);
-                    circle_circular.setPosition(Interpolate::easeOutCirc(t, 140.f, changeX, dur), 342.f);
-                    circle_back.setPosition(Interpolate::easeOutBack(t, 140.f, changeX, dur), 378.f);
-                    circle_elastic.setPosition(Interpolate::easeOutElastic(t, 140.f, changeX, dur), 414.f);
-                    circle_bounce.setPosition(Interpolate::easeOutBounce(t, 140.f, changeX, dur), 450.f);
+                    circle_linear.setPosition(ease<InterpFunc::Linear>(t, 140.f, changeX, dur), 90.f);
+                    circle_quadratic.setPosition(ease<InterpFunc::QuadEaseOut>(t, 140.f, changeX, dur), 127.f);
+                    circle_cubic.setPosition(ease<InterpFunc::CubicEaseOut>(t, 140.f, changeX, dur), 162.f);
+                    circle_quartic.setPosition(ease<InterpFunc::QuartEaseOut>(t, 140.f, changeX, dur), 198.f);
+                    circle_quintic.setPosition(ease<InterpFunc::QuintEaseOut>(t, 140.f, changeX, dur), 234.f);
+                    circle_sinesoidal.setPosition(ease<InterpFunc::SineEaseOut>(t, 140.f, changeX, dur), 270.f);
+                    circle_exponential.setPosition(ease<InterpFunc::ExpoEaseOut>(t, 140.f, changeX, dur), 306.f);
+                    circle_circular.setPosition(ease<InterpFunc::CircEaseOut>(t, 140.f, changeX, dur), 342.f);
+                    circle_back.setPosition(ease<InterpFunc::BackEaseOut>(t, 140.f, changeX, dur), 378.f);
+                    circle_elastic.setPosition(ease<InterpFunc::ElasticEaseOut>(t, 140.f, changeX, dur), 414.f);
+                    circle_bounce.setPosition(ease<InterpFunc::BounceEaseOut>(t, 140.f, changeX, dur), 450.f);
                 }
             }
             break;
@@ -825,17 +864,17 @@ void EasingDemo(RenderWindow& window, const Vector2f& resolution) {
                 {
                     float t = duration.asSeconds();
 
-                    circle_linear.setPosition(Interpolate::linear(t, 140.f, changeX, dur), 90.f);
-                    circle_quadratic.setPosition(Interpolate::easeInOutQuad(t, 140.f, changeX, dur), 127.f);
-                    circle_cubic.setPosition(Interpolate::easeInOutCubic(t, 140.f, changeX, dur), 162.f);
-                    circle_quartic.setPosition(Interpolate::easeInOutQuart(t, 140.f, changeX, dur), 198.f);
-                    circle_quintic.setPosition(Interpolate::easeInOutQuint(t, 140.f, changeX, dur), 234.f);
-                    circle_sinesoidal.setPosition(Interpolate::easeInOutSine(t, 140.f, changeX, dur), 270.f);
-                    circle_exponential.setPosition(Interpolate::easeInOutExpo(t, 140.f, changeX, dur), 306.f);
-                    circle_circular.setPosition(Interpolate::easeInOutCirc(t, 140.f, changeX, dur), 342.f);
-                    circle_back.setPosition(Interpolate::easeInOutBack(t, 140.f, changeX, dur), 378.f);
-                    circle_elastic.setPosition(Interpolate::easeInOutElastic(t, 140.f, changeX, dur), 414.f);
-                    circle_bounce.setPosition(Interpolate::easeInOutBounce(t, 140.f, changeX, dur), 450.f);
+                    circle_linear.setPosition(ease<InterpFunc::Linear>(t, 140.f, changeX, dur), 90.f);
+                    circle_quadratic.setPosition(ease<InterpFunc::QuadEaseInOut>(t, 140.f, changeX, dur), 127.f);
+                    circle_cubic.setPosition(ease<InterpFunc::CubicEaseInOut>(t, 140.f, changeX, dur), 162.f);
+                    circle_quartic.setPosition(ease<InterpFunc::QuartEaseInOut>(t, 140.f, changeX, dur), 198.f);
+                    circle_quintic.setPosition(ease<InterpFunc::QuintEaseInOut>(t, 140.f, changeX, dur), 234.f);
+                    circle_sinesoidal.setPosition(ease<InterpFunc::SineEaseInOut>(t, 140.f, changeX, dur), 270.f);
+                    circle_exponential.setPosition(ease<InterpFunc::ExpoEaseInOut>(t, 140.f, changeX, dur), 306.f);
+                    circle_circular.setPosition(ease<InterpFunc::CircEaseInOut>(t, 140.f, changeX, dur), 342.f);
+                    circle_back.setPosition(ease<InterpFunc::BackEaseInOut>(t, 140.f, changeX, dur), 378.f);
+                    circle_elastic.setPosition(ease<InterpFunc::ElasticEaseInOut>(t, 140.f, changeX, dur), 414.f);
+                    circle_bounce.setPosition(ease<InterpFunc::BounceEaseInOut>(t, 140.f, changeX, dur), 450.f);
                 }
             }
             break;
@@ -0,0 +1,75 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <vector>
+
+#include "engine/angle_interpolate.hpp"
+#include "engine/easing.hpp"
+#include "engine/interpolate.hpp"
+#include "engine/value_tween.hpp"
+
+using namespace animation;
+
+namespace {
+
+	// Angular distance, insensitive to wrapping
+	float angleDistance(float a, float b) {
+		float d = std::fmod(std::fabs(a - b), 360.f);
+		return std::min(d, 360.f - d);
+	}
+}
+
+TEST_CASE("Angles take the shortest arc", "[angle]") {
+	REQUIRE(AngleInterpolate::shortestArc(350.f, 10.f) == Approx(20.f));
+	REQUIRE(AngleInterpolate::shortestArc(10.f, 350.f) == Approx(-20.f));
+	REQUIRE(AngleInterpolate::shortestArc(0.f, 180.f) == Approx(-180.f));
+	REQUIRE(AngleInterpolate::shortestArc(-720.f, 90.f) == Approx(90.f));
+
+	REQUIRE(AngleInterpolate::wrap(-90.f) == Approx(270.f));
+	REQUIRE(AngleInterpolate::wrap(725.f) == Approx(5.f));
+	REQUIRE(AngleInterpolate::wrap(-1e-6f) < 360.f);
+
+	REQUIRE(AngleInterpolate::lerp(350.f, 10.f, 0.5f) == Approx(0.f).margin(1e-4));
+	REQUIRE(AngleInterpolate::lerp(350.f, 10.f, 0.25f) == Approx(355.f));
+	REQUIRE(AngleInterpolate::lerp(10.f, 350.f, 1.f) == Approx(350.f));
+}
+
+TEST_CASE("Batch rotations match the scalar form", "[angle]") {
+	const std::size_t count = 1003;
+	std::vector<float> t(count), from(count), to(count), out(count), weights(count);
+
+	for (std::size_t i = 0; i < count; ++i) {
+		t[i] = static_cast<float>(i % 101) / 100.f;
+		from[i] = static_cast<float>(i * 37 % 720) - 360.f;
+		to[i] = static_cast<float>(i * 53 % 1080) - 180.f;
+	}
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+		AngleInterpolate::evaluate(func, t.data(), from.data(), to.data(), out.data(), count);
+
+		// The batch weights follow the batch kernels, which differ from the
+		// scalar curves only at the expo snap points
+		Interpolate::evaluate(func, t.data(), weights.data(), count);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			INFO("func " << f << ", i " << i);
+			REQUIRE(out[i] >= 0.f);
+			REQUIRE(out[i] < 360.f);
+			REQUIRE(angleDistance(out[i], AngleInterpolate::lerp(from[i], to[i], weights[i])) <= 1e-3f);
+		}
+	}
+}
+
+TEST_CASE("Rotation tweens wrap through zero", "[angle]") {
+	float rotation = 340.f;
+	ValueTween<float, ShortestArcLerp> tween(&rotation, rotation, 30.f, 1.f, InterpFunc::Linear);
+	tween.start();
+
+	float previous = rotation;
+	while (tween.isAnimating()) {
+		tween.update(0.1f);
+		REQUIRE(angleDistance(rotation, previous) <= 5.f + 1e-3f);
+		previous = rotation;
+	}
+	REQUIRE(rotation == 30.f);
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+#include "engine/color_interpolate.hpp"
+#include "engine/easing.hpp"
+#include "engine/value_tween.hpp"
+
+using namespace animation;
+
+namespace {
+
+	bool near(const sf::Color& a, const sf::Color& b, int tolerance) {
+		return std::abs(a.r - b.r) <= tolerance && std::abs(a.g - b.g) <= tolerance
+			&& std::abs(a.b - b.b) <= tolerance && std::abs(a.a - b.a) <= tolerance;
+	}
+}
+
+TEST_CASE("sRGB decode and encode round trip exactly", "[color]") {
+	for (int i = 0; i < 256; ++i) {
+		sf::Uint8 c = static_cast<sf::Uint8>(i);
+		double reference = i / 255.0 <= 0.04045 ? i / 255.0 / 12.92 : std::pow((i / 255.0 + 0.055) / 1.055, 2.4);
+
+		REQUIRE(ColorInterpolate::toLinear(c) == Approx(reference).margin(1e-7));
+		REQUIRE(ColorInterpolate::toSRGB(ColorInterpolate::toLinear(c)) == c);
+	}
+
+	REQUIRE(ColorInterpolate::toSRGB(-1.f) == 0);
+	REQUIRE(ColorInterpolate::toSRGB(3.f) == 255);
+
+	// Halfway in light between black and white is sRGB 188
+	sf::Color mid = ColorInterpolate::lerp(sf::Color::Black, sf::Color::White, 0.5f, ColorSpace::LinearRGB);
+	REQUIRE(mid == sf::Color(188, 188, 188));
+}
+
+TEST_CASE("OKLab conversion matches the reference values", "[color]") {
+	ColorVector red = ColorInterpolate::decode(sf::Color::Red, ColorSpace::OKLab);
+	REQUIRE(red.x == Approx(0.627955).margin(1e-5));
+	REQUIRE(red.y == Approx(0.224863).margin(1e-5));
+	REQUIRE(red.z == Approx(0.125846).margin(1e-5));
+
+	ColorVector white = ColorInterpolate::decode(sf::Color::White, ColorSpace::OKLab);
+	REQUIRE(white.x == Approx(1.f).margin(1e-4));
+	REQUIRE(white.y == Approx(0.f).margin(1e-4));
+	REQUIRE(white.z == Approx(0.f).margin(1e-4));
+
+	std::srand(7);
+	for (int i = 0; i < 2000; ++i) {
+		sf::Color c(std::rand() % 256, std::rand() % 256, std::rand() % 256, std::rand() % 256);
+		for (ColorSpace space : { ColorSpace::SRGB, ColorSpace::LinearRGB, ColorSpace::OKLab }) {
+			REQUIRE(ColorInterpolate::encode(ColorInterpolate::decode(c, space), space) == c);
+			REQUIRE(ColorInterpolate::lerp(c, sf::Color::Blue, 0.f, space) == c);
+			REQUIRE(ColorInterpolate::lerp(sf::Color::Blue, c, 1.f, space) == c);
+		}
+	}
+}
+
+TEST_CASE("Vertex colour batches match the scalar blend", "[color]") {
+	const std::size_t count = 300;
+	std::vector<sf::Color> from(count), to(count);
+	std::vector<ColorVector> fromVec(count), toVec(count);
+	std::vector<sf::Vertex> vertices(count), scalar(count);
+
+	for (std::size_t i = 0; i < count; ++i) {
+		from[i] = sf::Color(i % 256, (i * 7) % 256, (i * 13) % 256, 255);
+		to[i] = sf::Color((i * 3) % 256, 255 - i % 256, (i * 5) % 256, (i * 11) % 256);
+	}
+
+	for (ColorSpace space : { ColorSpace::SRGB, ColorSpace::LinearRGB, ColorSpace::OKLab }) {
+		float t = 0.4f;
+		float w = easing::evaluate(InterpFunc::CubicEaseInOut, t);
+
+		ColorInterpolate::decode(from.data(), fromVec.data(), count, space);
+		ColorInterpolate::decode(to.data(), toVec.data(), count, space);
+		ColorInterpolate::blendVertexColors(fromVec.data(), toVec.data(), w, vertices.data(), count, space);
+		ColorInterpolate::blendVertexColors(InterpFunc::CubicEaseInOut, t, from.data(), to.data(),
+											scalar.data(), count, space);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			REQUIRE(vertices[i].color == scalar[i].color);
+			REQUIRE(vertices[i].color == ColorInterpolate::interpolate(InterpFunc::CubicEaseInOut, from[i], to[i], t, space));
+		}
+	}
+
+	// A tween through OKLab ends exactly on the target
+	sf::Color color = sf::Color::Red;
+	ValueTween<sf::Color, OklabColorLerp> tween(&color, color, sf::Color::Blue, 1.f, InterpFunc::SineEaseInOut);
+	tween.start();
+	tween.update(0.5f);
+	REQUIRE(near(color, ColorInterpolate::lerp(sf::Color::Red, sf::Color::Blue, 0.5f, ColorSpace::OKLab), 0));
+	tween.update(0.5f);
+	REQUIRE(color == sf::Color::Blue);
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <type_traits>
+
+#include "engine/cubic_bezier.hpp"
+#include "engine/tween.hpp"
+#include "engine/value_tween.hpp"
+
+using namespace animation;
+
+namespace {
+
+	// Double precision reference: bisect the parameter for x, return y
+	double referenceBezier(double x1, double y1, double x2, double y2, double t) {
+		auto coord = [](double s, double p1, double p2) {
+			double w = 1.0 - s;
+			return 3.0 * w * w * s * p1 + 3.0 * w * s * s * p2 + s * s * s;
+		};
+
+		double lo = 0.0;
+		double hi = 1.0;
+		for (int i = 0; i < 60; ++i) {
+			double s = 0.5 * (lo + hi);
+			(coord(s, x1, x2) < t ? lo : hi) = s;
+		}
+		return coord(0.5 * (lo + hi), y1, y2);
+	}
+}
+
+TEST_CASE("CubicBezier matches a double precision reference", "[cubicbezier]") {
+	const float curves[][4] = {
+		{ 0.25f, 0.1f, 0.25f, 1.f },
+		{ 0.42f, 0.f, 1.f, 1.f },
+		{ 0.f, 0.f, 0.58f, 1.f },
+		{ 0.68f, -0.6f, 0.32f, 1.6f },	// overshoots both ends
+		{ 0.9f, 0.1f, 0.1f, 0.9f },		// near flat slope in the middle
+		{ 0.f, 1.f, 1.f, 0.f }
+	};
+
+	for (const auto& p : curves) {
+		CubicBezier curve(p[0], p[1], p[2], p[3]);
+
+		for (int i = 0; i <= 1000; ++i) {
+			float t = static_cast<float>(i) / 1000.f;
+			double expected = referenceBezier(p[0], p[1], p[2], p[3], t);
+
+			INFO("curve " << p[0] << " " << p[1] << " " << p[2] << " " << p[3] << ", t " << t);
+			REQUIRE(std::fabs(curve.apply(t) - expected) <= 1e-4);
+		}
+	}
+
+	REQUIRE(CubicBezier(0.3f, 0.3f, 0.7f, 0.7f).apply(0.37f) == 0.37f);
+	REQUIRE(CubicBezier::Ease.apply(0.f) == 0.f);
+	REQUIRE(CubicBezier::Ease.apply(1.f) == 1.f);
+}
+
+TEST_CASE("CubicBezier derivatives and inverse", "[cubicbezier]") {
+	const CubicBezier& curve = CubicBezier::EaseInOut;
+	const float h = 1e-3f;
+
+	for (int i = 5; i <= 95; ++i) {
+		float t = static_cast<float>(i) / 100.f;
+		float dv = (curve.apply(t + h) - curve.apply(t - h)) / (2.f * h);
+		float da = (curve.velocity(t + h) - curve.velocity(t - h)) / (2.f * h);
+
+		INFO("t " << t);
+		REQUIRE(std::fabs(curve.velocity(t) - dv) <= 1e-2f * (1.f + std::fabs(dv)));
+		REQUIRE(std::fabs(curve.acceleration(t) - da) <= 1e-2f * (1.f + std::fabs(da)));
+		REQUIRE(std::fabs(curve.apply(curve.inverse(curve.apply(t))) - curve.apply(t)) <= 1e-5f);
+	}
+}
+
+TEST_CASE("Tweens share one bezier curve", "[cubicbezier]") {
+	const CubicBezier curve(0.17f, 0.67f, 0.83f, 0.67f);
+
+	float a = 0.f;
+	float b = 0.f;
+	Tween first(&a, 0.f, 100.f, 1.f, curve);
+	Tween second(&b, 50.f, 150.f, 2.f, curve);
+	first.start();
+	second.start();
+
+	first.update(0.25f);
+	second.update(0.5f);
+
+	REQUIRE(a == Approx(100.f * curve.apply(0.25f)));
+	REQUIRE(b == Approx(a + 50.f));
+}
+
+// Tweens keep a pointer to the curve, so temporaries must not bind
+static_assert(!std::is_constructible<Tween, float*, float, float, float, CubicBezier&&>::value,
+			  "Tween must not accept a temporary curve");
+static_assert(!std::is_constructible<ValueTween<float>, float*, float, float, float, CubicBezier&&>::value,
+			  "ValueTween must not accept a temporary curve");
+static_assert(std::is_constructible<Tween, float*, float, float, float, const CubicBezier&>::value,
+			  "Tween must accept a named curve");
@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "engine/easing.hpp"
+#include "engine/easing_expression.hpp"
+
+using namespace animation;
+
+namespace {
+
+	typedef EasingExpression Expr;
+
+	float ease(InterpFunc func, float t) {
+		return easing::evaluate(func, t);
+	}
+
+	// Compares a compiled expression against a direct scalar reference,
+	// through both the batch path (across several blocks) and apply()
+	void requireMatches(const Expr& expression, const std::function<float(float)>& reference) {
+		CompiledEasing compiled(expression);
+
+		const std::size_t count = CompiledEasing::BLOCK_SIZE * 3 + 17;
+		std::vector<float> t(count), out(count);
+		for (std::size_t i = 0; i < count; ++i)
+			t[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+
+		compiled.evaluate(t.data(), out.data(), count);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			INFO("t " << t[i]);
+			REQUIRE(out[i] == Approx(reference(t[i])).margin(1e-5));
+			REQUIRE(compiled.apply(t[i]) == Approx(out[i]).margin(1e-6));
+		}
+	}
+}
+
+TEST_CASE("Compiled expressions match their definitions", "[easingexpression]") {
+	const InterpFunc bounce = InterpFunc::BounceEaseOut;
+	const InterpFunc sine = InterpFunc::SineEaseIn;
+
+	requireMatches(Expr::curve(bounce), [&](float t) { return ease(bounce, t); });
+
+	requireMatches(Expr::curve(bounce).reverse(), [&](float t) { return ease(bounce, 1.f - t); });
+
+	requireMatches(Expr::curve(bounce).mirror(), [&](float t) {
+		return ease(bounce, t < 0.5f ? 2.f * t : 2.f - 2.f * t);
+	});
+
+	requireMatches(Expr::curve(InterpFunc::BackEaseOut).clamp(), [&](float t) {
+		return std::min(ease(InterpFunc::BackEaseOut, t), 1.f);
+	});
+
+	requireMatches(Expr::curve(sine).remap(0.25f, 0.75f), [&](float t) {
+		return ease(sine, std::min(std::max((t - 0.25f) / 0.5f, 0.f), 1.f));
+	});
+
+	requireMatches(Expr::curve(sine).remap(Expr::curve(InterpFunc::QuadEaseOut)), [&](float t) {
+		return ease(sine, ease(InterpFunc::QuadEaseOut, t));
+	});
+
+	requireMatches(Expr::sequence(Expr::curve(sine), Expr::curve(bounce).scale(-1.f, 1.f), 0.3f), [&](float t) {
+		return t < 0.3f ? ease(sine, t / 0.3f) : 1.f - ease(bounce, (t - 0.3f) / 0.7f);
+	});
+
+	// The example from the header: mirror(easeOutBounce) * 0.5 crossfaded with easeInSine
+	requireMatches(Expr::blend(Expr::curve(bounce).mirror().scale(0.5f), Expr::curve(sine), Expr::time()), [&](float t) {
+		float a = 0.5f * ease(bounce, t < 0.5f ? 2.f * t : 2.f - 2.f * t);
+		return a + (ease(sine, t) - a) * t;
+	});
+
+	requireMatches(Expr::blend(Expr::curve(sine), Expr::constant(2.f), 0.25f), [&](float t) {
+		return ease(sine, t) + (2.f - ease(sine, t)) * 0.25f;
+	});
+}
+
+TEST_CASE("Compiled expressions flatten to one op per node", "[easingexpression]") {
+	Expr leaf = Expr::curve(InterpFunc::CubicEaseOut);
+	CompiledEasing compiled(Expr::sequence(leaf, leaf.reverse()).scale(2.f));
+
+	// Two time transforms, two curves, one reverse, the select and the scale
+	REQUIRE(compiled.ops().size() == 7);
+	REQUIRE(compiled.apply(0.5f, 10.f, 4.f, 2.f) == Approx(10.f + 4.f * 2.f * easing::evaluate(InterpFunc::CubicEaseOut, 0.5f)));
+	REQUIRE(CompiledEasing(Expr::time()).apply(0.375f) == 0.375f);
+}
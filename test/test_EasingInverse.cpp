@@ -0,0 +1,63 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+
+#include "engine/easing.hpp"
+#include "engine/easing_inverse.hpp"
+#include "engine/tween.hpp"
+
+using namespace animation;
+
+TEST_CASE("EasingInverse maps values back to time", "[easinginverse]") {
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+
+		for (int i = 0; i <= 200; ++i) {
+			float t = static_cast<float>(i) / 200.f;
+			float value = easing::evaluate(func, t);
+			float solved = EasingInverse::solve(func, value);
+
+			INFO("func " << f << ", t " << t);
+			REQUIRE(solved >= 0.f);
+			REQUIRE(solved <= 1.f);
+			REQUIRE(std::fabs(easing::evaluate(func, solved) - value) <= 1e-4f);
+
+			// Monotonic curves have a single answer wherever they are not flat
+			if (EasingInverse::hasClosedForm(func) && easing::velocity(func, t) > 0.05f)
+				REQUIRE(std::fabs(solved - t) <= 2e-3f);
+
+			// Curves that revisit a value return its earliest time
+			if (!EasingInverse::hasClosedForm(func))
+				REQUIRE(solved <= t + 1e-2f);
+		}
+	}
+}
+
+TEST_CASE("InverseTable agrees with the solver", "[easinginverse]") {
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+		InverseTable table(func);
+
+		for (int i = 0; i <= 200; ++i) {
+			float value = easing::evaluate(func, static_cast<float>(i) / 200.f);
+			float solved = table.solve(value);
+
+			INFO("func " << f << ", value " << value);
+			REQUIRE(std::fabs(easing::evaluate(func, solved) - value) <= 1e-3f);
+		}
+	}
+}
+
+TEST_CASE("Tween resumes from a value", "[easinginverse]") {
+	float x = 0.f;
+	Tween tween(&x, 100.f, 300.f, 2.f, InterpFunc::BounceEaseOut);
+	tween.start();
+	tween.seekToValue(250.f);
+
+	REQUIRE(x == 250.f);
+	REQUIRE(tween.getElapsedTime() > 0.f);
+	REQUIRE(tween.getElapsedTime() < 2.f);
+
+	// The next frame continues from the sought value without a jump
+	tween.update(1e-4f);
+	REQUIRE(std::fabs(x - 250.f) < 1.f);
+}
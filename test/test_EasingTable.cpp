@@ -0,0 +1,51 @@
+#include <catch2/catch.hpp>
+
+#include "engine/easing.hpp"
+#include "engine/easing_table.hpp"
+#include "engine/tween.hpp"
+
+using namespace animation;
+
+TEST_CASE("EasingTable reports its reconstruction error", "[easingtable]") {
+	EasingTable::build(512, TableFilter::Hermite);
+
+	REQUIRE(EasingTable::isBuilt());
+	REQUIRE(EasingTable::resolution() == 512);
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+
+		// End points are sampled exactly
+		REQUIRE(EasingTable::evaluate(func, 0.f) == easing::evaluate(func, 0.f));
+		REQUIRE(EasingTable::evaluate(func, 1.f) == easing::evaluate(func, 1.f));
+
+		for (int i = 0; i <= 1000; ++i) {
+			float t = static_cast<float>(i) / 1000.f;
+			float error = std::fabs(EasingTable::evaluate(func, t) - easing::evaluate(func, t));
+			REQUIRE(error <= EasingTable::maxError(func) * 1.1f + 1e-6f);
+		}
+	}
+
+	// Smooth curves reconstruct far below a pixel on a 1000 px move
+	REQUIRE(EasingTable::maxError(InterpFunc::SineEaseInOut) < 1e-5f);
+	REQUIRE(EasingTable::maxError(InterpFunc::BackEaseOut) < 1e-5f);
+	REQUIRE(EasingTable::maxError() >= EasingTable::maxError(InterpFunc::CircEaseIn));
+}
+
+TEST_CASE("Tween can evaluate through the table", "[easingtable]") {
+	EasingTable::build(256, TableFilter::Linear);
+
+	float exact = 0.f;
+	float table = 0.f;
+	Tween a(&exact, 0.f, 100.f, 1.f, InterpFunc::ElasticEaseOut);
+	Tween b(&table, 0.f, 100.f, 1.f, InterpFunc::ElasticEaseOut);
+	b.useTable(true);
+	a.start();
+	b.start();
+
+	for (int i = 0; i < 50; ++i) {
+		a.update(1.f / 60.f);
+		b.update(1.f / 60.f);
+		REQUIRE(std::fabs(exact - table) <= 100.f * EasingTable::maxError(InterpFunc::ElasticEaseOut) + 1e-3f);
+	}
+}
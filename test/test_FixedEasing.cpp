@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "engine/easing.hpp"
+#include "engine/fixed_easing.hpp"
+
+using namespace animation;
+
+namespace {
+
+	const int SAMPLES = 4097;
+
+	fixedpoint::q16 sampleTime(int i) {
+		return static_cast<fixedpoint::q16>(static_cast<std::int64_t>(fixedpoint::ONE) * i / (SAMPLES - 1));
+	}
+
+	// FNV-1a over the raw bits of every sample of every curve
+	std::uint64_t checksum() {
+		std::uint64_t hash = 14695981039346656037ULL;
+
+		for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+			for (int i = 0; i < SAMPLES; ++i) {
+				std::uint32_t bits = static_cast<std::uint32_t>(
+					fixedpoint::evaluate(static_cast<InterpFunc>(f), sampleTime(i)));
+
+				for (int byte = 0; byte < 4; ++byte) {
+					hash ^= (bits >> (8 * byte)) & 0xff;
+					hash *= 1099511628211ULL;
+				}
+			}
+		}
+
+		return hash;
+	}
+}
+
+TEST_CASE("Fixed-point curves track the float curves", "[fixedeasing]") {
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+
+		for (int i = 0; i < SAMPLES; ++i) {
+			fixedpoint::q16 t = sampleTime(i);
+			float expected = easing::evaluate(func, fixedpoint::toFloat(t));
+			float actual = fixedpoint::toFloat(fixedpoint::evaluate(func, t));
+
+			INFO("func " << f << ", t " << fixedpoint::toFloat(t));
+			REQUIRE(std::fabs(actual - expected) <= 1e-4f);
+		}
+
+		REQUIRE(fixedpoint::evaluate(func, 0) == 0);
+		REQUIRE(fixedpoint::evaluate(func, fixedpoint::ONE) == fixedpoint::ONE);
+	}
+}
+
+TEST_CASE("Fixed-point curves are bit-identical to the reference", "[fixedeasing]") {
+	// Any change to this value changes lockstep results across builds
+	REQUIRE(checksum() == 0x9933249ef9e39f59ULL);
+
+	static_assert(fixedpoint::SineEaseOut::apply(fixedpoint::ONE) == fixedpoint::ONE, "");
+	static_assert(fixedpoint::sqrt(fixedpoint::ONE / 4) == fixedpoint::HALF, "");
+	static_assert(fixedpoint::exp2(fixedpoint::fromInt(-1)) == fixedpoint::HALF, "");
+}
+
+TEST_CASE("Fixed-point batch matches the scalar form", "[fixedeasing]") {
+	const std::size_t count = 1000;
+	const fixedpoint::q16 d = fixedpoint::fromInt(2);
+	std::vector<fixedpoint::q16> t(count), b(count), c(count), out(count), norm(count);
+
+	for (std::size_t i = 0; i < count; ++i) {
+		t[i] = static_cast<fixedpoint::q16>(d * static_cast<std::int64_t>(i) / (count - 1));
+		b[i] = fixedpoint::fromInt(static_cast<int>(i % 7) - 3);
+		c[i] = fixedpoint::fromInt(static_cast<int>(i % 11) * 50);
+	}
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+		fixedpoint::evaluate(func, t.data(), b.data(), c.data(), d, out.data(), count);
+		fixedpoint::evaluate(func, t.data(), norm.data(), count);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			REQUIRE(out[i] == fixedpoint::evaluate(func, t[i], b[i], c[i], d));
+			REQUIRE(norm[i] == fixedpoint::evaluate(func, t[i]));
+		}
+	}
+}
@@ -0,0 +1,286 @@
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "engine/interpolate.hpp"
+#include "engine/easing.hpp"
+#include "engine/tween.hpp"
+
+using namespace animation;
+
+namespace {
+
+	// Scalar reference matching the dispatch in Tween::update()
+	float scalarEase(InterpFunc func, float t, float b, float c, float d) {
+		switch (func) {
+		case InterpFunc::Linear:           return Interpolate::linear(t, b, c, d);
+		case InterpFunc::QuadEaseIn:       return Interpolate::easeInQuad(t, b, c, d);
+		case InterpFunc::QuadEaseOut:      return Interpolate::easeOutQuad(t, b, c, d);
+		case InterpFunc::QuadEaseInOut:    return Interpolate::easeInOutQuad(t, b, c, d);
+		case InterpFunc::CubicEaseIn:      return Interpolate::easeInCubic(t, b, c, d);
+		case InterpFunc::CubicEaseOut:     return Interpolate::easeOutCubic(t, b, c, d);
+		case InterpFunc::CubicEaseInOut:   return Interpolate::easeInOutCubic(t, b, c, d);
+		case InterpFunc::QuartEaseIn:      return Interpolate::easeInQuart(t, b, c, d);
+		case InterpFunc::QuartEaseOut:     return Interpolate::easeOutQuart(t, b, c, d);
+		case InterpFunc::QuartEaseInOut:   return Interpolate::easeInOutQuart(t, b, c, d);
+		case InterpFunc::QuintEaseIn:      return Interpolate::easeInQuint(t, b, c, d);
+		case InterpFunc::QuintEaseOut:     return Interpolate::easeOutQuint(t, b, c, d);
+		case InterpFunc::QuintEaseInOut:   return Interpolate::easeInOutQuint(t, b, c, d);
+		case InterpFunc::SineEaseIn:       return Interpolate::easeInSine(t, b, c, d);
+		case InterpFunc::SineEaseOut:      return Interpolate::easeOutSine(t, b, c, d);
+		case InterpFunc::SineEaseInOut:    return Interpolate::easeInOutSine(t, b, c, d);
+		case InterpFunc::ExpoEaseIn:       return Interpolate::easeInExpo(t, b, c, d);
+		case InterpFunc::ExpoEaseOut:      return Interpolate::easeOutExpo(t, b, c, d);
+		case InterpFunc::ExpoEaseInOut:    return Interpolate::easeInOutExpo(t, b, c, d);
+		case InterpFunc::CircEaseIn:       return Interpolate::easeInCirc(t, b, c, d);
+		case InterpFunc::CircEaseOut:      return Interpolate::easeOutCirc(t, b, c, d);
+		case InterpFunc::CircEaseInOut:    return Interpolate::easeInOutCirc(t, b, c, d);
+		case InterpFunc::BackEaseIn:       return Interpolate::easeInBack(t, b, c, d);
+		case InterpFunc::BackEaseOut:      return Interpolate::easeOutBack(t, b, c, d);
+		case InterpFunc::BackEaseInOut:    return Interpolate::easeInOutBack(t, b, c, d);
+		case InterpFunc::ElasticEaseIn:    return Interpolate::easeInElastic(t, b, c, d);
+		case InterpFunc::ElasticEaseOut:   return Interpolate::easeOutElastic(t, b, c, d);
+		case InterpFunc::ElasticEaseInOut: return Interpolate::easeInOutElastic(t, b, c, d);
+		case InterpFunc::BounceEaseIn:     return Interpolate::easeInBounce(t, b, c, d);
+		case InterpFunc::BounceEaseOut:    return Interpolate::easeOutBounce(t, b, c, d);
+		case InterpFunc::BounceEaseInOut:  return Interpolate::easeInOutBounce(t, b, c, d);
+		default:                           return Interpolate::easeOutQuart(t, b, c, d);
+		}
+	}
+
+	/** True when value is within 1e-5 (relative) of the range scalar(x) covers for x within 2 ulp of t.
+
+	The batch kernels may fuse multiply-adds the scalar functions round
+	separately, which moves the elastic phase by a fraction of an ulp;
+	near the zero crossings of the elastic acceleration that alone shifts
+	the result by more than 1e-5.
+	*/
+	template<class Scalar>
+	bool nearScalar(float value, float t, Scalar scalar) {
+		float x = std::nextafter(std::nextafter(t, -1e9f), -1e9f);
+		float lo = scalar(x);
+		float hi = lo;
+
+		for (int step = 0; step < 4; ++step) {
+			x = std::nextafter(x, 1e9f);
+			lo = std::min(lo, scalar(x));
+			hi = std::max(hi, scalar(x));
+		}
+
+		float tolerance = 1e-5f * (1.f + std::max(std::fabs(lo), std::fabs(hi)));
+		return value >= lo - tolerance && value <= hi + tolerance;
+	}
+}
+
+TEST_CASE("Interpolate::evaluate matches the scalar functions", "[interpolate]") {
+	// Odd count so the scalar tail runs after the vector loop
+	const std::size_t count = 1001;
+
+	std::vector<float> t(count), b(count), c(count), d(count), out(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		d[i] = 0.5f + static_cast<float>(i % 7);
+		t[i] = d[i] * static_cast<float>(i) / static_cast<float>(count - 1);
+		b[i] = -50.f + static_cast<float>(i % 13) * 10.f;
+		c[i] = 200.f - static_cast<float>(i % 11) * 40.f;
+	}
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+		Interpolate::evaluate(func, t.data(), b.data(), c.data(), d.data(), out.data(), count);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			float expected = scalarEase(func, t[i], b[i], c[i], d[i]);
+			float tolerance = Interpolate::BATCH_TOLERANCE * (1.f + std::fabs(b[i]) + std::fabs(c[i]));
+
+			INFO("func " << f << ", t " << t[i] / d[i]);
+			REQUIRE(std::fabs(out[i] - expected) <= tolerance);
+		}
+	}
+}
+
+TEST_CASE("Interpolate::evaluate normalized form", "[interpolate]") {
+	const std::size_t count = 257;
+
+	std::vector<float> t(count), out(count);
+	for (std::size_t i = 0; i < count; ++i)
+		t[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+		Interpolate::evaluate(func, t.data(), out.data(), count);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			INFO("func " << f << ", t " << t[i]);
+			REQUIRE(std::fabs(out[i] - scalarEase(func, t[i], 0.f, 1.f, 1.f)) <= 2.f * Interpolate::BATCH_TOLERANCE);
+		}
+	}
+}
+
+TEST_CASE("every supported instruction set matches the scalar functions", "[interpolate]") {
+	const InstructionSet original = Interpolate::batchInstructionSetId();
+	const InstructionSet all[] = {
+		InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512, InstructionSet::NEON
+	};
+
+	// Covers the vector loop and a tail for up to 16 lanes
+	const std::size_t count = 77;
+	std::vector<float> t(count), out(count);
+	for (std::size_t i = 0; i < count; ++i)
+		t[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+
+	REQUIRE(Interpolate::useInstructionSet(InstructionSet::Scalar));
+
+	for (InstructionSet isa : all) {
+		if (!Interpolate::useInstructionSet(isa))
+			continue;
+		REQUIRE(Interpolate::batchInstructionSetId() == isa);
+
+		for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+			InterpFunc func = static_cast<InterpFunc>(f);
+			Interpolate::evaluate(func, t.data(), out.data(), count);
+
+			for (std::size_t i = 0; i < count; ++i) {
+				INFO(Interpolate::batchInstructionSet() << ", func " << f << ", t " << t[i]);
+				REQUIRE(std::fabs(out[i] - scalarEase(func, t[i], 0.f, 1.f, 1.f)) <= 2.f * Interpolate::BATCH_TOLERANCE);
+			}
+
+			Interpolate::evaluateVelocity(func, t.data(), out.data(), count);
+			for (std::size_t i = 0; i < count; ++i) {
+				INFO(Interpolate::batchInstructionSet() << ", velocity func " << f << ", t " << t[i]);
+				REQUIRE(nearScalar(out[i], t[i], [&](float x) { return easing::velocity<fastmath::FastMath>(func, x); }));
+			}
+
+			Interpolate::evaluateAcceleration(func, t.data(), out.data(), count);
+			for (std::size_t i = 0; i < count; ++i) {
+				INFO(Interpolate::batchInstructionSet() << ", acceleration func " << f << ", t " << t[i]);
+				REQUIRE(nearScalar(out[i], t[i], [&](float x) { return easing::acceleration<fastmath::FastMath>(func, x); }));
+			}
+		}
+	}
+
+	REQUIRE(Interpolate::useInstructionSet(original));
+}
+
+TEST_CASE("easing functors are usable at compile time", "[interpolate]") {
+	static_assert(easing::ease<InterpFunc::QuadEaseIn>(0.5f) == 0.25f, "constexpr quad");
+	static_assert(easing::ease<InterpFunc::BounceEaseOut>(1.f) > 0.99f, "constexpr bounce");
+
+	REQUIRE(easing::ease<InterpFunc::Linear>(2.f, 10.f, 20.f, 4.f) == Approx(20.f));
+	REQUIRE(easing::evaluate(InterpFunc::QuartEaseOut, 0.5f) == Approx(Interpolate::easeOutQuart(0.5f)));
+	REQUIRE(Interpolate::easeInOutQuart(0.25f) == Interpolate::easeInOutQuard(0.25f));
+}
+
+TEST_CASE("Fast and Fastest precision stay within their documented error", "[interpolate]") {
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+
+		for (int i = 0; i <= 1000; ++i) {
+			float t = static_cast<float>(i) / 1000.f;
+			float exact = easing::evaluate(func, EasingPrecision::Exact, t);
+
+			INFO("func " << f << ", t " << t);
+			REQUIRE(std::fabs(easing::evaluate(func, EasingPrecision::Fast, t) - exact) <= 1e-6f);
+			REQUIRE(std::fabs(easing::evaluate(func, EasingPrecision::Fastest, t) - exact) <= 1.5e-4f);
+		}
+	}
+}
+
+TEST_CASE("Tween precision follows the global default", "[interpolate]") {
+	float value = 0.f;
+	Tween tween(&value, 0.f, 1.f, 1.f, InterpFunc::SineEaseOut);
+
+	REQUIRE(tween.getPrecision() == EasingPrecision::Default);
+
+	Tween::setDefaultPrecision(EasingPrecision::Fastest);
+	tween.start();
+	tween.update(0.3f);
+	REQUIRE(value == easing::evaluate(InterpFunc::SineEaseOut, EasingPrecision::Fastest, 0.3f, 0.f, 1.f, 1.f));
+
+	tween.setPrecision(EasingPrecision::Exact);
+	tween.update(0.1f);
+	REQUIRE(value == easing::evaluate(InterpFunc::SineEaseOut, 0.4f, 0.f, 1.f, 1.f));
+
+	Tween::setDefaultPrecision(EasingPrecision::Default);
+	REQUIRE(Tween::getDefaultPrecision() == EasingPrecision::Exact);
+}
+
+namespace {
+
+	// True when a finite difference stencil of half width h around t crosses
+	// a point where the curve's velocity or acceleration jumps
+	bool nearKink(InterpFunc func, float t, float h) {
+		const float d1 = 2.75f;
+		const float bounce[] = { 1.f / d1, 2.f / d1, 2.5f / d1 };
+
+		std::vector<float> kinks = { 0.5f };
+		for (float k : bounce) {
+			switch (func) {
+			case InterpFunc::BounceEaseOut:   kinks.push_back(k); break;
+			case InterpFunc::BounceEaseIn:    kinks.push_back(1.f - k); break;
+			case InterpFunc::BounceEaseInOut: kinks.push_back(0.5f - k / 2.f); kinks.push_back(0.5f + k / 2.f); break;
+			default: break;
+			}
+		}
+
+		for (float k : kinks)
+			if (std::fabs(t - k) <= 2.f * h)
+				return true;
+		return false;
+	}
+}
+
+TEST_CASE("velocity and acceleration match finite differences", "[interpolate]") {
+	const float h = 1e-3f;
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+
+		for (int i = 2; i <= 98; ++i) {
+			float t = static_cast<float>(i) / 100.f;
+			if (nearKink(func, t, h))
+				continue;
+
+			float v = Interpolate::velocity(func, t);
+			float a = Interpolate::acceleration(func, t);
+			float dv = (easing::evaluate(func, t + h) - easing::evaluate(func, t - h)) / (2.f * h);
+			float da = (Interpolate::velocity(func, t + h) - Interpolate::velocity(func, t - h)) / (2.f * h);
+
+			INFO("func " << f << ", t " << t);
+			REQUIRE(std::fabs(v - dv) <= 1e-2f * (1.f + std::fabs(v)));
+			REQUIRE(std::fabs(a - da) <= 1e-2f * (1.f + std::fabs(a)));
+		}
+	}
+
+	static_assert(easing::velocity<InterpFunc::QuadEaseIn>(0.5f) == 1.f, "constexpr velocity");
+	REQUIRE(Interpolate::velocity(InterpFunc::Linear, 1.f, 10.f, 100.f, 2.f) == Approx(50.f));
+	REQUIRE(Interpolate::acceleration(InterpFunc::QuadEaseIn, 1.f, 0.f, 100.f, 2.f) == Approx(50.f));
+}
+
+TEST_CASE("batch derivatives match the scalar FastMath functions", "[interpolate]") {
+	const std::size_t count = 203;
+
+	std::vector<float> t(count), b(count, 5.f), c(count, -40.f), d(count, 2.f), out(count);
+	for (std::size_t i = 0; i < count; ++i)
+		t[i] = 2.f * static_cast<float>(i) / static_cast<float>(count - 1);
+
+	for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+		InterpFunc func = static_cast<InterpFunc>(f);
+
+		Interpolate::evaluateVelocity(func, t.data(), b.data(), c.data(), d.data(), out.data(), count);
+		for (std::size_t i = 0; i < count; ++i) {
+			INFO("func " << f << ", t " << t[i]);
+			REQUIRE(nearScalar(out[i], t[i], [&](float x) {
+				return easing::velocity<fastmath::FastMath>(func, x, b[i], c[i], d[i]);
+			}));
+		}
+
+		Interpolate::evaluateAcceleration(func, t.data(), b.data(), c.data(), d.data(), out.data(), count);
+		for (std::size_t i = 0; i < count; ++i) {
+			INFO("func " << f << ", t " << t[i]);
+			REQUIRE(nearScalar(out[i], t[i], [&](float x) {
+				return easing::acceleration<fastmath::FastMath>(func, x, b[i], c[i], d[i]);
+			}));
+		}
+	}
+}
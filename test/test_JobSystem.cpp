@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "engine/job_system.hpp"
+
+using namespace animation;
+
+TEST_CASE("JobSystem runs every index exactly once", "[jobsystem]") {
+	const std::size_t threadCounts[] = { 1, 2, 4, 8 };
+	const std::size_t counts[] = { 0, 1, 7, 64, 1000, 4097 };
+	const std::size_t grains[] = { 1, 3, 64, 5000 };
+
+	for (std::size_t threads : threadCounts) {
+		JobSystem jobs(threads);
+		REQUIRE(jobs.threadCount() == threads);
+
+		for (std::size_t count : counts) {
+			for (std::size_t grain : grains) {
+				// Catch assertions are not thread-safe, so the bodies only record
+				std::vector<int> hits(count, 0);
+				std::atomic<bool> oversized(false);
+
+				jobs.parallelFor(count, grain, [&](std::size_t begin, std::size_t end) {
+					if (end - begin > grain)
+						oversized = true;
+					for (std::size_t i = begin; i < end; ++i)
+						++hits[i];
+				});
+
+				INFO(threads << " threads, " << count << " items, grain " << grain);
+				REQUIRE_FALSE(oversized);
+				for (std::size_t i = 0; i < count; ++i)
+					REQUIRE(hits[i] == 1);
+			}
+		}
+	}
+}
+
+TEST_CASE("JobSystem threads steal ranges from a busy thread", "[jobsystem]") {
+	JobSystem jobs(4);
+	std::vector<std::thread::id> runners(64);
+
+	// Ranges dealt to the calling thread are slow, so the other threads
+	// run out of their own work and take some of them
+	jobs.parallelFor(runners.size(), 1, [&](std::size_t begin, std::size_t) {
+		if (begin % 4 == 0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		runners[begin] = std::this_thread::get_id();
+	});
+
+	std::size_t stolen = 0;
+	for (std::size_t i = 0; i < runners.size(); i += 4) {
+		if (runners[i] != std::this_thread::get_id())
+			++stolen;
+	}
+	REQUIRE(stolen > 0);
+
+	// The pool is reusable, and a single thread runs everything inline
+	JobSystem inlineJobs(1);
+	std::size_t sum = 0;
+	std::thread::id runner;
+	inlineJobs.parallelFor(100, 10, [&](std::size_t begin, std::size_t end) {
+		runner = std::this_thread::get_id();
+		for (std::size_t i = begin; i < end; ++i)
+			sum += i;
+	});
+	REQUIRE(sum == 4950);
+	REQUIRE(runner == std::this_thread::get_id());
+}
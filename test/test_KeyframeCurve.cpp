@@ -0,0 +1,75 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <vector>
+
+#include "engine/easing.hpp"
+#include "engine/keyframe_curve.hpp"
+
+using namespace animation;
+
+namespace {
+
+	// Linear scan reference
+	float referenceEvaluate(const KeyframeCurve& curve, float time) {
+		std::size_t n = curve.keyCount();
+		if (time <= curve.time(0)) return curve.value(0);
+		if (time >= curve.time(n - 1)) return curve.value(n - 1);
+
+		std::size_t i = 0;
+		while (curve.time(i + 1) <= time)
+			++i;
+
+		float u = (time - curve.time(i)) / (curve.time(i + 1) - curve.time(i));
+		float w = easing::evaluate(curve.function(i), u);
+		return curve.value(i) + (curve.value(i + 1) - curve.value(i)) * w;
+	}
+}
+
+TEST_CASE("KeyframeCurve matches a linear scan", "[keyframe]") {
+	KeyframeCurve curve;
+	curve.reserve(2000);
+	for (int i = 0; i < 2000; ++i) {
+		float time = static_cast<float>(i) * 0.5f + static_cast<float>(i % 3) * 0.1f;
+		float value = static_cast<float>((i * 37) % 101) - 50.f;
+		curve.addKey(time, value, static_cast<InterpFunc>(1 + i % INTERP_FUNC_COUNT));
+	}
+
+	REQUIRE(curve.keyCount() == 2000);
+
+	// Forward playback through a cursor
+	KeyframeCursor cursor;
+	for (float time = -1.f; time <= curve.endTime() + 1.f; time += 0.037f) {
+		INFO("time " << time);
+		REQUIRE(curve.evaluate(time, cursor) == referenceEvaluate(curve, time));
+	}
+
+	// Random seeks, with and without the cursor
+	for (int i = 0; i < 500; ++i) {
+		float time = static_cast<float>((i * 7919) % 10007) / 10007.f * curve.endTime();
+		INFO("time " << time);
+		REQUIRE(curve.evaluate(time) == referenceEvaluate(curve, time));
+		REQUIRE(curve.evaluate(time, cursor) == referenceEvaluate(curve, time));
+	}
+}
+
+TEST_CASE("KeyframeCurve hits its keys and holds the ends", "[keyframe]") {
+	KeyframeCurve curve;
+	curve.addKey(0.f, 10.f, InterpFunc::QuadEaseIn);
+	curve.addKey(1.f, 20.f, InterpFunc::BounceEaseOut);
+	curve.addKey(3.f, -5.f);
+
+	REQUIRE(curve.evaluate(-2.f) == 10.f);
+	REQUIRE(curve.evaluate(1.f) == 20.f);
+	REQUIRE(curve.evaluate(3.f) == -5.f);
+	REQUIRE(curve.evaluate(9.f) == -5.f);
+	REQUIRE(curve.evaluate(0.5f) == Approx(10.f + 10.f * 0.25f));
+
+	std::vector<float> times = { 0.f, 0.5f, 1.f, 2.f, 3.f };
+	std::vector<float> out(times.size());
+	KeyframeCursor cursor;
+	curve.evaluate(times.data(), out.data(), times.size(), cursor);
+
+	for (std::size_t i = 0; i < times.size(); ++i)
+		REQUIRE(out[i] == curve.evaluate(times[i]));
+	REQUIRE(cursor.segment == 1);
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <vector>
+
+#include "engine/easing.hpp"
+#include "engine/easing_expression.hpp"
+#include "engine/piecewise_polynomial.hpp"
+
+using namespace animation;
+
+namespace {
+
+	// Largest error over a grid much denser than the fitter's check points
+	template<class Curve>
+	float measure(const PiecewisePolynomial& fit, Curve curve) {
+		const int samples = 20000;
+		float error = 0.f;
+
+		for (int i = 0; i <= samples; ++i) {
+			float t = static_cast<float>(i) / samples;
+			error = std::max(error, std::fabs(fit.apply(t) - curve(t)));
+		}
+		return error;
+	}
+}
+
+TEST_CASE("Piecewise fits of every curve stay within tolerance", "[piecewise]") {
+	const float tolerance = 1e-4f;
+
+	for (int degree = 3; degree <= 4; ++degree) {
+		for (int f = 1; f <= INTERP_FUNC_COUNT; ++f) {
+			InterpFunc func = static_cast<InterpFunc>(f);
+			PiecewisePolynomial fit(func, tolerance, degree);
+
+			// The circular curves have unbounded slope at an end or the middle,
+			// where the float curve itself is noisy
+			bool circ = func == InterpFunc::CircEaseIn || func == InterpFunc::CircEaseOut
+				|| func == InterpFunc::CircEaseInOut;
+			float bound = circ ? 3.f * tolerance : tolerance;
+
+			INFO("func " << f << ", degree " << degree << ", segments " << fit.segmentCount());
+			REQUIRE(fit.maxError() <= bound);
+			REQUIRE(measure(fit, [&](float t) { return easing::evaluate(func, t); }) <= 2.f * bound);
+			REQUIRE(fit.apply(0.f) == easing::evaluate(func, 0.f));
+			REQUIRE(fit.apply(1.f) == easing::evaluate(func, 1.f));
+		}
+	}
+
+	// Cubics are exact on a single segment
+	REQUIRE(PiecewisePolynomial(InterpFunc::CubicEaseIn).segmentCount() == 1);
+}
+
+TEST_CASE("Piecewise fits place segments where the curve needs them", "[piecewise]") {
+	PiecewisePolynomial fit(InterpFunc::BounceEaseOut, 1e-4f);
+
+	// The kinks of the bounce sit at 4/11, 8/11 and 10/11
+	std::size_t nearKink = 0;
+	for (std::size_t i = 1; i < fit.segmentCount(); ++i) {
+		float b = fit.breakpoint(i);
+		float dist = std::min({ std::fabs(b - 4.f / 11.f), std::fabs(b - 8.f / 11.f), std::fabs(b - 10.f / 11.f) });
+		if (dist < 0.01f)
+			++nearKink;
+	}
+	REQUIRE(nearKink * 2 > fit.segmentCount());
+}
+
+TEST_CASE("Piecewise fits of composites and lambdas", "[piecewise]") {
+	CompiledEasing composite(EasingExpression::curve(InterpFunc::BounceEaseOut).mirror().scale(0.5f));
+	PiecewisePolynomial fitComposite(composite, 1e-4f);
+	REQUIRE(measure(fitComposite, [&](float t) { return composite.apply(t); }) <= 2e-4f);
+
+	auto smootherstep = [](float t) { return t * t * t * (t * (6.f * t - 15.f) + 10.f); };
+	PiecewisePolynomial fitLambda(smootherstep, 1e-5f, 4);
+	REQUIRE(measure(fitLambda, smootherstep) <= 2e-5f);
+
+	const std::size_t count = 999;
+	std::vector<float> t(count), out(count);
+	for (std::size_t i = 0; i < count; ++i)
+		t[i] = static_cast<float>(i) / (count - 1) * 1.2f - 0.1f;
+
+	fitComposite.evaluate(t.data(), out.data(), count);
+	for (std::size_t i = 0; i < count; ++i)
+		REQUIRE(out[i] == fitComposite.apply(t[i]));
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+#include "engine/easing.hpp"
+#include "engine/spline_path.hpp"
+
+using namespace animation;
+
+namespace {
+
+	float distance(const sf::Vector2f& a, const sf::Vector2f& b) {
+		return std::hypot(b.x - a.x, b.y - a.y);
+	}
+}
+
+TEST_CASE("Spline paths are parameterized by distance", "[spline]") {
+	// The repeated end points ease the parameter in and out, yet the
+	// distance mapping keeps the speed constant
+	SplinePath line(SplineType::CatmullRom, { { 0.f, 0.f }, { 50.f, 0.f }, { 100.f, 0.f } });
+	REQUIRE(line.length() == Approx(100.f).epsilon(1e-4));
+	for (int i = 0; i <= 10; ++i)
+		REQUIRE(line.positionAt(i * 10.f).x == Approx(i * 10.f).margin(1e-2));
+
+	// Quarter circle of radius 100 from the standard bezier approximation
+	const float k = 100.f * 0.5522847f;
+	SplinePath arc(SplineType::Bezier, { { 100.f, 0.f }, { 100.f, k }, { k, 100.f }, { 0.f, 100.f } });
+	REQUIRE(arc.length() == Approx(100.f * 3.14159265f / 2.f).epsilon(1e-3));
+
+	const int steps = 200;
+	float step = arc.length() / steps;
+	for (int i = 1; i <= steps; ++i) {
+		sf::Vector2f a = arc.positionAt(step * (i - 1));
+		sf::Vector2f b = arc.positionAt(step * i);
+		REQUIRE(distance(a, b) == Approx(step).epsilon(1e-2));
+		REQUIRE(std::hypot(b.x, b.y) == Approx(100.f).epsilon(1e-3));
+	}
+
+	sf::Vector2f tangent = arc.tangentAt(0.f);
+	REQUIRE(tangent.x == Approx(0.f).margin(1e-4));
+	REQUIRE(tangent.y == Approx(1.f));
+
+	REQUIRE(arc.positionAt(-5.f) == arc.pointAtParameter(0.f));
+	REQUIRE(arc.positionAt(1e6f) == arc.pointAtParameter(1.f));
+}
+
+TEST_CASE("Spline cursors match random access", "[spline]") {
+	std::vector<sf::Vector2f> points;
+	for (int i = 0; i < 40; ++i)
+		points.push_back(sf::Vector2f(i * 20.f, std::sin(i * 0.7f) * 80.f));
+
+	// Catmull-Rom passes through its points
+	SplinePath path(SplineType::CatmullRom, points);
+	REQUIRE(path.pointAtParameter(7.f) == points[7]);
+
+	SplineCursor cursor;
+	std::vector<float> distances;
+	for (int frame = 0; frame <= 300; ++frame)
+		distances.push_back(easing::evaluate(InterpFunc::SineEaseInOut, frame / 300.f) * path.length());
+	distances.push_back(path.length() * 0.25f);		// seek backwards
+
+	std::vector<sf::Vector2f> out(distances.size());
+	path.evaluate(distances.data(), out.data(), distances.size(), cursor);
+
+	for (std::size_t i = 0; i < distances.size(); ++i) {
+		sf::Vector2f expected = path.positionAt(distances[i]);
+		REQUIRE(out[i].x == Approx(expected.x).margin(1e-3));
+		REQUIRE(out[i].y == Approx(expected.y).margin(1e-3));
+	}
+
+	SplineCursor follower;
+	sf::Vector2f end = path.evaluate(InterpFunc::QuadEaseOut, 1.f, follower);
+	REQUIRE(end.x == Approx(points.back().x));
+	REQUIRE(end.y == Approx(points.back().y).margin(1e-3));
+}
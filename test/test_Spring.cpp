@@ -0,0 +1,119 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "engine/spring.hpp"
+#include "engine/tween.hpp"
+#include "engine/value_tween.hpp"
+
+using namespace animation;
+
+namespace {
+
+	// Semi-implicit Euler integration of m x'' = -k x - c x' from x = 1
+	float integrateSpring(float k, float c, float m, float v0, float seconds) {
+		const int steps = 200000;
+		double dt = seconds / steps;
+		double x = 1.0;
+		double v = -v0;
+
+		for (int i = 0; i < steps; ++i) {
+			v += (-k * x - c * v) / m * dt;
+			x += v * dt;
+		}
+		return static_cast<float>(1.0 - x);
+	}
+}
+
+TEST_CASE("Spring matches numerical integration in every regime", "[spring]") {
+	const float params[][4] = {
+		{ 170.f, 10.f, 1.f, 0.f },		// underdamped
+		{ 100.f, 20.f, 1.f, 0.f },		// critical
+		{ 100.f, 60.f, 2.f, 3.f },		// overdamped with initial velocity
+		{ 300.f, 5.f, 0.5f, -2.f }		// underdamped, starts moving away
+	};
+	const SpringRegime regimes[] = {
+		SpringRegime::Underdamped, SpringRegime::Critical,
+		SpringRegime::Overdamped, SpringRegime::Underdamped
+	};
+
+	for (int p = 0; p < 4; ++p) {
+		const float* q = params[p];
+		Spring spring(q[0], q[1], q[2], q[3]);
+		REQUIRE(spring.regime() == regimes[p]);
+
+		for (int i = 1; i < 10; ++i) {
+			float seconds = spring.settleDuration() * static_cast<float>(i) / 10.f;
+			INFO("spring " << p << ", seconds " << seconds);
+			REQUIRE(spring.position(seconds) == Approx(integrateSpring(q[0], q[1], q[2], q[3], seconds)).margin(1e-3));
+		}
+
+		// Settled within tolerance by the end of the duration
+		REQUIRE(std::fabs(spring.position(spring.settleDuration() * 0.99f) - 1.f) <= Spring::SETTLE_TOLERANCE * 1.1f);
+		REQUIRE(spring.apply(0.f) == 0.f);
+		REQUIRE(spring.apply(1.f) == 1.f);
+	}
+}
+
+TEST_CASE("Spring batch, derivatives and inverse", "[spring]") {
+	Spring spring(170.f, 12.f);
+	const std::size_t count = 301;
+
+	std::vector<float> t(count), out(count);
+	for (std::size_t i = 0; i < count; ++i)
+		t[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+
+	spring.evaluate(t.data(), out.data(), count);
+	for (std::size_t i = 0; i < count; ++i)
+		REQUIRE(std::fabs(out[i] - spring.apply(t[i])) <= 1e-5f);
+
+	const float h = 1e-3f;
+	for (int i = 5; i <= 95; ++i) {
+		float u = static_cast<float>(i) / 100.f;
+		float dv = (spring.apply(u + h) - spring.apply(u - h)) / (2.f * h);
+		float da = (spring.velocity(u + h) - spring.velocity(u - h)) / (2.f * h);
+
+		INFO("t " << u);
+		REQUIRE(std::fabs(spring.velocity(u) - dv) <= 1e-2f * (1.f + std::fabs(dv)));
+		REQUIRE(std::fabs(spring.acceleration(u) - da) <= 1e-2f * (1.f + std::fabs(da)));
+	}
+
+	for (int i = 1; i < 10; ++i) {
+		float value = static_cast<float>(i) / 10.f;
+		REQUIRE(spring.apply(spring.inverse(value)) == Approx(value).margin(1e-5));
+	}
+}
+
+TEST_CASE("Spring inverse with a large initial velocity", "[spring]") {
+	// Fast enough that the first velocity zero is the overshoot peak itself
+	Spring spring(100.f, 10.f, 1.f, 25.f);
+
+	for (int i = 1; i < 10; ++i) {
+		float value = static_cast<float>(i) / 10.f;
+		REQUIRE(spring.apply(spring.inverse(value)) == Approx(value).margin(1e-5));
+	}
+}
+
+TEST_CASE("Tween derives its duration from a spring", "[spring]") {
+	Spring spring(200.f, 15.f);
+	float x = 0.f;
+
+	Tween tween(&x, 0.f, 100.f, spring);
+	tween.start();
+	tween.update(0.1f);
+	REQUIRE(x == Approx(100.f * spring.position(0.1f)));
+
+	tween.update(spring.settleDuration());
+	REQUIRE(x == 100.f);
+	REQUIRE(!tween.isAnimating());
+	REQUIRE(Spring::settleDuration(200.f, 15.f) == Approx(spring.settleDuration()));
+}
+
+// Tweens keep a pointer to the spring, so temporaries must not bind
+static_assert(!std::is_constructible<Tween, float*, float, float, Spring&&>::value,
+			  "Tween must not accept a temporary spring");
+static_assert(!std::is_constructible<ValueTween<float>, float*, float, float, Spring&&>::value,
+			  "ValueTween must not accept a temporary spring");
+static_assert(std::is_constructible<Tween, float*, float, float, const Spring&>::value,
+			  "Tween must accept a named spring");
@@ -0,0 +1,281 @@
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+#include "engine/easing.hpp"
+#include "engine/interpolate.hpp"
+#include "engine/job_system.hpp"
+#include "engine/tween.hpp"
+#include "engine/tween_manager.hpp"
+
+using namespace animation;
+
+TEST_CASE("TweenManager matches individual Tweens frame by frame", "[tweenmanager]") {
+	const std::size_t count = 200;
+	const float frame = 1.f / 60.f;
+
+	std::vector<float> managed(count, 0.f);
+	std::vector<float> reference(count, 0.f);
+	std::deque<Tween> tweens;
+	TweenManager manager;
+
+	// Different durations so tweens finish, and are compacted, on different frames
+	for (std::size_t i = 0; i < count; ++i) {
+		InterpFunc func = static_cast<InterpFunc>(1 + i % INTERP_FUNC_COUNT);
+		float start = -50.f + static_cast<float>(i);
+		float target = 200.f - static_cast<float>(i % 17) * 10.f;
+		float duration = 0.25f + static_cast<float>(i % 13) * 0.1f;
+
+		manager.add(&managed[i], start, target, duration, func);
+		tweens.emplace_back(&reference[i], start, target, duration, func);
+		tweens.back().start();
+	}
+
+	REQUIRE(manager.size() == count);
+
+	for (int step = 0; step < 120; ++step) {
+		manager.update(frame);
+		for (Tween& tween : tweens)
+			tween.update(frame);
+
+		std::size_t running = 0;
+		for (std::size_t i = 0; i < count; ++i) {
+			INFO("tween " << i << ", frame " << step);
+			REQUIRE(managed[i] == Approx(reference[i]).margin(1e-4));
+			REQUIRE(manager.isAnimating(&managed[i]) == tweens[i].isAnimating());
+			running += tweens[i].isAnimating() ? 1 : 0;
+		}
+		REQUIRE(manager.size() == running);
+
+		std::size_t bucketed = 0;
+		for (int id = 1; id <= INTERP_FUNC_COUNT; ++id)
+			bucketed += manager.size(static_cast<InterpFunc>(id));
+		REQUIRE(bucketed == running);
+	}
+
+	REQUIRE(manager.empty());
+}
+
+TEST_CASE("TweenManager lands on the exact target", "[tweenmanager]") {
+	float value = 0.f;
+	TweenManager manager;
+
+	manager.add(&value, 0.1f, 0.7f, 1.f, InterpFunc::ElasticEaseOut);
+	manager.update(0.5f);
+	REQUIRE(value != 0.7f);
+
+	manager.update(0.6f);
+	REQUIRE(value == 0.7f);
+	REQUIRE(manager.empty());
+
+	// Resuming part-way continues along the same curve
+	manager.add(&value, 0.f, 100.f, 2.f, InterpFunc::QuadEaseIn, 1.f);
+	manager.update(0.5f);
+	REQUIRE(value == Approx(56.25f));
+
+	manager.update(1.f);
+	REQUIRE(value == 100.f);
+	REQUIRE(manager.empty());
+
+	// A zero duration finishes on the first update
+	manager.add(&value, 1.f, 2.f, 0.f);
+	manager.update(0.f);
+	REQUIRE(value == 2.f);
+	REQUIRE(manager.empty());
+}
+
+TEST_CASE("TweenManager stop and clear leave the current values", "[tweenmanager]") {
+	float a = 0.f, b = 0.f, c = 0.f;
+	TweenManager manager;
+	manager.reserve(4);
+
+	manager.add(&a, 0.f, 10.f, 1.f, InterpFunc::Linear);
+	manager.add(&b, 0.f, 10.f, 1.f, InterpFunc::Linear);
+	manager.add(&a, 0.f, 20.f, 1.f, InterpFunc::Linear);
+	manager.add(&c, 0.f, 10.f, 1.f, InterpFunc::Linear);
+	manager.update(0.5f);
+
+	REQUIRE(manager.stop(&a) == 2);
+	REQUIRE_FALSE(manager.isAnimating(&a));
+	REQUIRE(manager.isAnimating(&b));
+	REQUIRE(manager.isAnimating(&c));
+	REQUIRE(manager.size() == 2);
+	REQUIRE(manager.stop(&a) == 0);
+
+	// The tween moved into a's old slot still updates from where it was
+	manager.update(0.25f);
+	REQUIRE(a == 10.f);
+	REQUIRE(b == Approx(7.5f));
+	REQUIRE(c == Approx(7.5f));
+
+	manager.clear();
+	manager.update(1.f);
+	REQUIRE(manager.empty());
+	REQUIRE(b == Approx(7.5f));
+}
+
+TEST_CASE("TweenManager counts tweens per easing function", "[tweenmanager]") {
+	float values[6] = {};
+	TweenManager manager;
+
+	manager.add(&values[0], 0.f, 1.f, 1.f, InterpFunc::Linear);
+	manager.add(&values[1], 0.f, 1.f, 2.f, InterpFunc::Linear);
+	manager.add(&values[2], 0.f, 1.f, 1.f, InterpFunc::BounceEaseOut);
+	manager.add(&values[3], 0.f, 1.f, 2.f, InterpFunc::BounceEaseOut);
+	manager.add(&values[4], 0.f, 1.f, 2.f, InterpFunc::BounceEaseOut);
+
+	// Unknown ids run as QuartEaseOut, like easing::dispatch()
+	manager.add(&values[5], 0.f, 1.f, 2.f, static_cast<InterpFunc>(99));
+
+	REQUIRE(manager.size(InterpFunc::Linear) == 2);
+	REQUIRE(manager.size(InterpFunc::BounceEaseOut) == 3);
+	REQUIRE(manager.size(InterpFunc::QuartEaseOut) == 1);
+	REQUIRE(manager.size(InterpFunc::SineEaseIn) == 0);
+
+	manager.update(1.f);
+	REQUIRE(manager.size(InterpFunc::Linear) == 1);
+	REQUIRE(manager.size(InterpFunc::BounceEaseOut) == 2);
+	REQUIRE(values[1] == Approx(0.5f));
+	REQUIRE(values[5] == Approx(easing::evaluate(InterpFunc::QuartEaseOut, 0.5f)));
+
+	REQUIRE(manager.stop(&values[3]) == 1);
+	REQUIRE(manager.size(InterpFunc::BounceEaseOut) == 1);
+	REQUIRE(manager.size() == 3);
+}
+
+TEST_CASE("TweenManager does not allocate per frame once warmed up", "[tweenmanager]") {
+	std::vector<float> values(64, 0.f);
+	TweenManager manager;
+
+	// Spawn and finish the same mix of tweens every few frames
+	auto spawn = [&] {
+		for (std::size_t i = 0; i < values.size(); ++i) {
+			InterpFunc func = static_cast<InterpFunc>(1 + i % 4);
+			manager.add(&values[i], 0.f, 1.f, 0.05f, func);
+		}
+	};
+
+	spawn();
+	const std::size_t allocations = manager.allocationCount();
+	REQUIRE(allocations > 0);
+
+	for (int frame = 0; frame < 300; ++frame) {
+		if (manager.empty())
+			spawn();
+		manager.update(1.f / 60.f);
+		REQUIRE(manager.allocationCount() == allocations);
+	}
+}
+
+TEST_CASE("TweenManager updates identically on any number of threads", "[tweenmanager]") {
+	// Several chunks per bucket, uneven bucket sizes and tweens finishing
+	// (and being compacted) on different frames
+	const std::size_t count = 3 * TweenManager::CHUNK_SIZE + 1234;
+	const std::size_t threadCounts[] = { 2, 3, 8 };
+
+	auto fill = [&](TweenManager& manager, std::vector<float>& values) {
+		for (std::size_t i = 0; i < count; ++i) {
+			InterpFunc func = static_cast<InterpFunc>(1 + (i * 7) % INTERP_FUNC_COUNT);
+			float duration = 0.05f + static_cast<float>(i % 29) * 0.01f;
+			manager.add(&values[i], static_cast<float>(i % 100), -50.f, duration, func);
+		}
+	};
+
+	std::vector<float> reference(count, 0.f);
+	TweenManager single;
+	fill(single, reference);
+
+	for (std::size_t threads : threadCounts) {
+		std::vector<float> values(count, 0.f);
+		TweenManager parallel;
+		animation::JobSystem jobs(threads);
+		fill(parallel, values);
+
+		std::vector<float> expected(count, 0.f);
+		TweenManager serial;
+		fill(serial, expected);
+
+		for (int frame = 0; frame < 30; ++frame) {
+			parallel.update(1.f / 60.f, jobs);
+			serial.update(1.f / 60.f);
+
+			INFO(threads << " threads, frame " << frame);
+			REQUIRE(parallel.size() == serial.size());
+			REQUIRE(values == expected);
+		}
+	}
+}
+
+TEST_CASE("TweenManager follows the default precision", "[tweenmanager]") {
+	float managed = 0.f;
+	float reference = 0.f;
+
+	TweenManager manager;
+	Tween tween(&reference, 0.f, 100.f, 1.f, InterpFunc::SineEaseInOut);
+	manager.add(&managed, 0.f, 100.f, 1.f, InterpFunc::SineEaseInOut);
+	tween.start();
+
+	manager.update(0.3f);
+	tween.update(0.3f);
+	REQUIRE(managed == Approx(reference).margin(1e-4));
+
+	// Fastest runs on the batch kernels, which keep FastMath accuracy
+	Tween::setDefaultPrecision(EasingPrecision::Fastest);
+	manager.stop(&managed);
+	manager.add(&managed, 0.f, 100.f, 1.f, InterpFunc::SineEaseInOut);
+	manager.update(0.3f);
+	Tween::setDefaultPrecision(EasingPrecision::Exact);
+
+	float fast = 100.f * easing::evaluate(InterpFunc::SineEaseInOut, EasingPrecision::Fast, 0.3f);
+	REQUIRE(std::fabs(managed - fast) <= 101.f * Interpolate::BATCH_TOLERANCE);
+}
+
+TEST_CASE("TweenManager batch kernels match the scalar curves", "[tweenmanager]") {
+	const InstructionSet original = Interpolate::batchInstructionSetId();
+	const InstructionSet all[] = {
+		InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512, InstructionSet::NEON
+	};
+
+	// Uneven bucket sizes cover the vector loop and its tail; each tween
+	// starts at a different phase
+	const std::size_t count = 31 * 37;
+	auto start = [](std::size_t i) { return static_cast<float>(i % 9) - 4.f; };
+	auto change = [](std::size_t i) { return static_cast<float>(i % 5) * 2.f - 3.f; };
+
+	auto fill = [&](TweenManager& manager, std::vector<float>& values) {
+		for (std::size_t i = 0; i < count; ++i) {
+			InterpFunc func = static_cast<InterpFunc>(1 + (i * 5) % INTERP_FUNC_COUNT);
+			float duration = 0.5f + static_cast<float>(i % 7) * 0.25f;
+			float phase = static_cast<float>(i % 23) / 23.f;
+			manager.add(&values[i], start(i), start(i) + change(i), duration, func, phase * duration);
+		}
+	};
+
+	for (InstructionSet isa : all) {
+		if (!Interpolate::useInstructionSet(isa))
+			continue;
+
+		std::vector<float> scalar(count, 0.f), batch(count, 0.f);
+		TweenManager scalarManager, batchManager;
+		fill(scalarManager, scalar);
+		fill(batchManager, batch);
+
+		for (int frame = 0; frame < 10; ++frame) {
+			scalarManager.update(1.f / 60.f);
+
+			Tween::setDefaultPrecision(EasingPrecision::Fast);
+			batchManager.update(1.f / 60.f);
+			Tween::setDefaultPrecision(EasingPrecision::Exact);
+
+			REQUIRE(batchManager.size() == scalarManager.size());
+			for (std::size_t i = 0; i < count; ++i) {
+				INFO(Interpolate::batchInstructionSet() << ", tween " << i << ", frame " << frame);
+				float tolerance = Interpolate::BATCH_TOLERANCE * (1.f + std::fabs(start(i)) + std::fabs(change(i)));
+				REQUIRE(std::fabs(batch[i] - scalar[i]) <= 2.f * tolerance);
+			}
+		}
+	}
+
+	REQUIRE(Interpolate::useInstructionSet(original));
+}
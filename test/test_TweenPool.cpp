@@ -0,0 +1,187 @@
+#include <catch2/catch.hpp>
+#include <vector>
+
+#include "engine/tween.hpp"
+#include "engine/tween_pool.hpp"
+#include "engine/value_tween.hpp"
+
+TEST_CASE("TweenPool handles go stale when their tween finishes", "[tweenpool]") {
+	float value = 0.f;
+	TweenPool<Tween> pool;
+
+	TweenHandle handle = pool.create(&value, 0.f, 10.f, 1.f, InterpFunc::Linear);
+	REQUIRE_FALSE(handle.isNull());
+	REQUIRE(pool.isValid(handle));
+	REQUIRE(pool.size() == 1);
+
+	// Not started: update leaves it alone and keeps the slot
+	pool.update(0.5f);
+	REQUIRE(value == 0.f);
+	REQUIRE(pool.isValid(handle));
+
+	pool.get(handle)->start();
+	pool.update(0.5f);
+	REQUIRE(value == Approx(5.f));
+
+	pool.update(0.5f);
+	REQUIRE(value == 10.f);
+	REQUIRE_FALSE(pool.isValid(handle));
+	REQUIRE(pool.get(handle) == nullptr);
+	REQUIRE(pool.empty());
+
+	// Null handles never resolve
+	REQUIRE_FALSE(pool.isValid(TweenHandle()));
+	REQUIRE_FALSE(pool.stop(TweenHandle()));
+}
+
+TEST_CASE("TweenPool recycles slots with a new generation", "[tweenpool]") {
+	float a = 0.f, b = 0.f;
+	TweenPool<Tween> pool;
+
+	TweenHandle first = pool.create(&a, 0.f, 1.f, 1.f);
+	REQUIRE(pool.stop(first));
+	REQUIRE_FALSE(pool.stop(first));
+
+	TweenHandle second = pool.create(&b, 0.f, 1.f, 1.f);
+	REQUIRE(second.index == first.index);
+	REQUIRE(second.generation != first.generation);
+	REQUIRE(second != first);
+
+	// The old handle must not reach the tween now in its slot
+	REQUIRE_FALSE(pool.isValid(first));
+	REQUIRE(pool.get(first) == nullptr);
+	REQUIRE_FALSE(pool.seek(first, 0.5f));
+	REQUIRE(b == 0.f);
+	REQUIRE(pool.isValid(second));
+}
+
+TEST_CASE("TweenPool does not allocate after warm-up", "[tweenpool]") {
+	const std::size_t count = 100;
+	std::vector<float> values(count, 0.f);
+	std::vector<TweenHandle> handles;
+	TweenPool<Tween> pool;
+
+	for (std::size_t i = 0; i < count; ++i)
+		handles.push_back(pool.create(&values[i], 0.f, 1.f, 1.f));
+
+	const std::size_t capacity = pool.capacity();
+	const std::size_t allocations = pool.allocationCount();
+	REQUIRE(capacity >= count);
+
+	// Churn through many short tweens at the same peak count
+	for (int round = 0; round < 50; ++round) {
+		for (std::size_t i = 0; i < count; ++i) {
+			pool.get(handles[i])->start();
+		}
+		pool.update(2.f);
+		REQUIRE(pool.empty());
+
+		for (std::size_t i = 0; i < count; ++i) {
+			REQUIRE_FALSE(pool.isValid(handles[i]));
+			handles[i] = pool.create(&values[i], 0.f, 1.f, 0.25f, InterpFunc::QuadEaseIn);
+		}
+		REQUIRE(pool.capacity() == capacity);
+		REQUIRE(pool.allocationCount() == allocations);
+	}
+
+	REQUIRE(pool.highWaterMark() == count);
+
+	pool.clear();
+	REQUIRE(pool.empty());
+	REQUIRE(pool.capacity() == capacity);
+}
+
+TEST_CASE("Fixed TweenPools allocate only on construction", "[tweenpool]") {
+	float values[4] = {};
+	TweenPool<Tween> pool(3, PoolGrowth::Fixed);
+
+	REQUIRE(pool.capacity() == 3);
+	REQUIRE(pool.getGrowth() == PoolGrowth::Fixed);
+	const std::size_t allocations = pool.allocationCount();
+	REQUIRE(allocations > 0);
+
+	TweenHandle handles[4];
+	for (int i = 0; i < 4; ++i)
+		handles[i] = pool.create(&values[i], 0.f, 1.f, 1.f);
+
+	REQUIRE_FALSE(handles[2].isNull());
+	REQUIRE(handles[3].isNull());
+	REQUIRE(pool.failedCreateCount() == 1);
+	REQUIRE(pool.size() == 3);
+
+	// Freeing a slot makes room again
+	REQUIRE(pool.stop(handles[0]));
+	handles[3] = pool.create(&values[3], 0.f, 1.f, 1.f);
+	REQUIRE(pool.isValid(handles[3]));
+
+	REQUIRE(pool.capacity() == 3);
+	REQUIRE(pool.allocationCount() == allocations);
+	REQUIRE(pool.highWaterMark() == 3);
+}
+
+TEST_CASE("Growing TweenPools add blocks of their capacity", "[tweenpool]") {
+	std::vector<float> values(10, 0.f);
+	TweenPool<Tween> pool(4);
+
+	REQUIRE(pool.getGrowth() == PoolGrowth::Grow);
+	const std::size_t allocations = pool.allocationCount();
+
+	for (std::size_t i = 0; i < values.size(); ++i)
+		REQUIRE_FALSE(pool.create(&values[i], 0.f, 1.f, 1.f).isNull());
+
+	REQUIRE(pool.capacity() == 12);
+	REQUIRE(pool.allocationCount() > allocations);
+	REQUIRE(pool.highWaterMark() == 10);
+	REQUIRE(pool.failedCreateCount() == 0);
+
+	// An empty default pool has not allocated yet
+	TweenPool<Tween> lazy;
+	REQUIRE(lazy.capacity() == 0);
+	REQUIRE(lazy.allocationCount() == 0);
+	lazy.create(&values[0], 0.f, 1.f, 1.f);
+	REQUIRE(lazy.capacity() == TweenPool<Tween>::DEFAULT_BLOCK_SIZE);
+}
+
+TEST_CASE("TweenPool seeks and stops by handle", "[tweenpool]") {
+	float value = 0.f;
+	TweenPool<Tween> pool;
+
+	TweenHandle handle = pool.create(&value, 0.f, 100.f, 2.f, InterpFunc::QuadEaseIn);
+	REQUIRE(pool.seek(handle, 1.f));
+	REQUIRE(value == Approx(25.f));
+	REQUIRE(pool.get(handle)->getElapsedTime() == 1.f);
+
+	pool.get(handle)->start();
+	pool.update(0.5f);
+	REQUIRE(value == Approx(56.25f));
+
+	// Stop leaves the property where it is
+	REQUIRE(pool.stop(handle));
+	pool.update(0.5f);
+	REQUIRE(value == Approx(56.25f));
+	REQUIRE(pool.empty());
+}
+
+TEST_CASE("TweenPool keeps ValueTweens in place", "[tweenpool]") {
+	std::vector<float> values(40, 0.f);
+	std::vector<TweenHandle> handles;
+	TweenPool<ValueTween<float>> pool;
+
+	// Enough to span several chunks; ValueTween points into itself, so
+	// growing the pool must not move the earlier tweens
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		handles.push_back(pool.create(&values[i], 0.f, static_cast<float>(i), 1.f, InterpFunc::Linear));
+		pool.get(handles.back())->start();
+	}
+
+	pool.update(0.5f);
+	for (std::size_t i = 0; i < values.size(); ++i)
+		REQUIRE(values[i] == Approx(0.5f * static_cast<float>(i)));
+
+	REQUIRE(pool.seek(handles[3], 0.25f));
+	REQUIRE(values[3] == Approx(0.75f));
+
+	pool.update(1.f);
+	REQUIRE(pool.empty());
+	REQUIRE(values[39] == 39.f);
+}
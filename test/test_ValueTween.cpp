@@ -0,0 +1,67 @@
+#include <catch2/catch.hpp>
+#include <SFML/Graphics.hpp>
+
+#include "engine/easing.hpp"
+#include "engine/lerp_traits.hpp"
+#include "engine/value_tween.hpp"
+
+using namespace animation;
+
+TEST_CASE("Lerp traits blend every component with one weight", "[valuetween]") {
+	sf::Vector2f v = interpolate(InterpFunc::SineEaseOut, sf::Vector2f(0.f, 100.f), sf::Vector2f(10.f, 300.f), 0.5f);
+	float w = easing::evaluate(InterpFunc::SineEaseOut, 0.5f);
+	REQUIRE(v.x == Approx(10.f * w));
+	REQUIRE(v.y == Approx(100.f + 200.f * w));
+
+	// Colour channels round and saturate when the curve overshoots
+	sf::Color c = LerpTraits<sf::Color>::lerp(sf::Color(0, 100, 200, 255), sf::Color(255, 200, 250, 0), 0.5f);
+	REQUIRE(c == sf::Color(128, 150, 225, 128));
+	REQUIRE(LerpTraits<sf::Color>::lerp(sf::Color(0, 0, 0), sf::Color(255, 255, 255), 1.2f) == sf::Color(255, 255, 255));
+
+	// Premultiplied: fading from transparent black keeps the opaque colour's hue
+	sf::Color p = PremultipliedColorLerp::lerp(sf::Color(0, 0, 0, 0), sf::Color(200, 100, 50, 255), 0.25f);
+	REQUIRE(p == sf::Color(200, 100, 50, 64));
+
+	sf::Transform a(1.f, 0.f, 10.f, 0.f, 1.f, 20.f, 0.f, 0.f, 1.f);
+	sf::Transform b(3.f, 0.f, 30.f, 0.f, 5.f, 60.f, 0.f, 0.f, 1.f);
+	sf::Transform blended = LerpTraits<sf::Transform>::lerp(a, b, 0.5f);
+	const float* m = blended.getMatrix();
+	REQUIRE(m[0] == 2.f);
+	REQUIRE(m[5] == 3.f);
+	REQUIRE(m[12] == 20.f);
+	REQUIRE(m[13] == 40.f);
+	REQUIRE(m[15] == 1.f);
+}
+
+TEST_CASE("ValueTween matches two float tweens", "[valuetween]") {
+	sf::Vector2f position(10.f, -5.f);
+	float x = 10.f;
+	float y = -5.f;
+
+	ValueTween<sf::Vector2f> tween(&position, position, sf::Vector2f(110.f, 45.f), 2.f, InterpFunc::BackEaseOut);
+	Tween tweenX(&x, x, 110.f, 2.f, InterpFunc::BackEaseOut);
+	Tween tweenY(&y, y, 45.f, 2.f, InterpFunc::BackEaseOut);
+	tween.start();
+	tweenX.start();
+	tweenY.start();
+
+	while (tween.isAnimating()) {
+		tween.update(1.f / 60.f);
+		tweenX.update(1.f / 60.f);
+		tweenY.update(1.f / 60.f);
+
+		REQUIRE(position.x == Approx(x).margin(1e-4));
+		REQUIRE(position.y == Approx(y).margin(1e-4));
+		REQUIRE(tween.isAnimating() == tweenX.isAnimating());
+	}
+
+	REQUIRE(position == sf::Vector2f(110.f, 45.f));
+
+	sf::Color color = sf::Color::Red;
+	ValueTween<sf::Color, PremultipliedColorLerp> fade(&color, color, sf::Color::Transparent, 1.f, InterpFunc::Linear);
+	fade.start();
+	fade.update(0.5f);
+	REQUIRE(color == sf::Color(255, 0, 0, 128));
+	fade.update(0.5f);
+	REQUIRE(color == sf::Color::Transparent);
+}